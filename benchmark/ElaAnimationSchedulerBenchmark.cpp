@@ -0,0 +1,113 @@
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QTimer>
+#include <cstdio>
+
+#include "ElaAnimationScheduler.h"
+#include "ElaApplication.h"
+#include "ElaBenchmarkReporter.h"
+
+// 共享动画调度器的正确性检查与逐帧开销 离屏运行 结果以JSON输出 检查失败时返回非零
+struct ElaAnimationSchedulerBenchmarkConfig
+{
+    int animationCount{500};
+    int duration{300};
+    int iterations{5};
+};
+
+// 运行事件循环直到所有动画结束或超时
+static bool waitForAnimations(int timeoutMsec)
+{
+    QElapsedTimer timer;
+    timer.start();
+    while (eAnimationScheduler->getActiveAnimationCount() > 0)
+    {
+        if (timer.elapsed() > timeoutMsec)
+        {
+            return false;
+        }
+        QEventLoop loop;
+        QTimer::singleShot(5, &loop, &QEventLoop::quit);
+        loop.exec();
+    }
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+    {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication a(argc, argv);
+    eApp->init();
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("ElaAnimationScheduler benchmark");
+    parser.addHelpOption();
+    QCommandLineOption countOption("animations", "Concurrent animations per iteration.", "count", "500");
+    QCommandLineOption durationOption("duration", "Animation duration in msec.", "msec", "300");
+    QCommandLineOption iterationOption("iterations", "Iterations.", "count", "5");
+    QCommandLineOption outputOption({"o", "output"}, "Write JSON report to file instead of stdout.", "path");
+    parser.addOptions({countOption, durationOption, iterationOption, outputOption});
+    parser.process(a);
+
+    ElaAnimationSchedulerBenchmarkConfig config;
+    config.animationCount = qMax(1, parser.value(countOption).toInt());
+    config.duration = qMax(1, parser.value(durationOption).toInt());
+    config.iterations = qMax(1, parser.value(iterationOption).toInt());
+
+    ElaBenchmarkReporter reporter("ElaAnimationSchedulerBenchmark");
+    reporter.setParameter("animations", config.animationCount);
+    reporter.setParameter("duration", config.duration);
+    reporter.setParameter("iterations", config.iterations);
+
+    QObject target;
+    int timeoutMsec = config.duration * 10 + 1000;
+    // 单个动画 调度器空闲时启动也必须推进到终值并触发结束回调
+    qreal singleValue = 0;
+    bool isSingleFinished = false;
+    eAnimationScheduler->startAnimation(&target, "SingleValue", 0, 1, config.duration, QEasingCurve::Linear, [&](qreal value) { singleValue = value; }, nullptr, [&]() { isSingleFinished = true; });
+    bool isSinglePassed = waitForAnimations(timeoutMsec) && isSingleFinished && qFuzzyCompare(singleValue, 1.0);
+    reporter.addValue("single_animation_passed", isSinglePassed ? 1 : 0, "bool", {{"endValue", singleValue}, {"finished", isSingleFinished}});
+    if (!isSinglePassed)
+    {
+        fprintf(stderr, "single animation did not finish: value=%f finished=%d\n", singleValue, isSingleFinished);
+    }
+
+    // 并发动画的逐帧开销
+    QVector<double> frameSampleVector;
+    QVector<double> wallSampleVector;
+    bool isConcurrentPassed = true;
+    for (int iteration = 0; iteration < config.iterations; iteration++)
+    {
+        QVector<QObject*> targetVector;
+        QVector<qreal> valueVector(config.animationCount, 0);
+        int finishedCount = 0;
+        for (int i = 0; i < config.animationCount; i++)
+        {
+            QObject* animationTarget = new QObject(&target);
+            targetVector.append(animationTarget);
+            eAnimationScheduler->startAnimation(animationTarget, "Value", 0, 1, config.duration, QEasingCurve::InOutSine, [&valueVector, i](qreal value) { valueVector[i] = value; }, nullptr, [&finishedCount]() { finishedCount++; });
+        }
+        eAnimationScheduler->resetStatistics();
+        QElapsedTimer timer;
+        timer.start();
+        bool isFinished = waitForAnimations(timeoutMsec);
+        wallSampleVector.append(ElaBenchmarkReporter::elapsedMsec(timer));
+        frameSampleVector.append(eAnimationScheduler->getAverageFrameCostNsec() / 1000000.0);
+        isConcurrentPassed = isConcurrentPassed && isFinished && finishedCount == config.animationCount && valueVector.count(1.0) == config.animationCount;
+        qDeleteAll(targetVector);
+    }
+    reporter.addResult("frame_cost", frameSampleVector, "ms", {{"animations", config.animationCount}, {"poolSize", eAnimationScheduler->getPoolSize()}});
+    reporter.addResult("wall_time", wallSampleVector, "ms");
+    reporter.addValue("concurrent_animation_passed", isConcurrentPassed ? 1 : 0, "bool");
+    if (!isConcurrentPassed)
+    {
+        fprintf(stderr, "concurrent animations did not all finish\n");
+    }
+    bool isWritten = reporter.write(parser.value(outputOption));
+    return isWritten && isSinglePassed && isConcurrentPassed ? 0 : 1;
+}
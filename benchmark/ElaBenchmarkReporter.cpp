@@ -0,0 +1,89 @@
+#include "ElaBenchmarkReporter.h"
+
+#include <QDateTime>
+#include <QDebug>
+#include <QFile>
+#include <QJsonDocument>
+#include <QSysInfo>
+#include <algorithm>
+#include <cstdio>
+
+ElaBenchmarkReporter::ElaBenchmarkReporter(const QString& benchmarkName)
+    : _benchmarkName(benchmarkName)
+{
+}
+
+ElaBenchmarkReporter::~ElaBenchmarkReporter()
+{
+}
+
+void ElaBenchmarkReporter::setParameter(const QString& key, const QVariant& value)
+{
+    _parameterObject.insert(key, QJsonValue::fromVariant(value));
+}
+
+void ElaBenchmarkReporter::addResult(const QString& resultName, QVector<double> sampleVector, const QString& unit, const QVariantMap& extraMap)
+{
+    QJsonObject resultObject = QJsonObject::fromVariantMap(extraMap);
+    resultObject.insert("name", resultName);
+    resultObject.insert("unit", unit);
+    resultObject.insert("samples", sampleVector.count());
+    if (!sampleVector.isEmpty())
+    {
+        std::sort(sampleVector.begin(), sampleVector.end());
+        double sum = 0;
+        for (auto sample : sampleVector)
+        {
+            sum += sample;
+        }
+        int count = sampleVector.count();
+        resultObject.insert("min", sampleVector.first());
+        resultObject.insert("mean", sum / count);
+        resultObject.insert("median", count % 2 ? sampleVector[count / 2] : (sampleVector[count / 2 - 1] + sampleVector[count / 2]) / 2);
+        resultObject.insert("p95", sampleVector[qMin(count - 1, static_cast<int>(count * 0.95))]);
+        resultObject.insert("max", sampleVector.last());
+    }
+    _resultArray.append(resultObject);
+}
+
+void ElaBenchmarkReporter::addValue(const QString& resultName, double value, const QString& unit, const QVariantMap& extraMap)
+{
+    QJsonObject resultObject = QJsonObject::fromVariantMap(extraMap);
+    resultObject.insert("name", resultName);
+    resultObject.insert("unit", unit);
+    resultObject.insert("value", value);
+    _resultArray.append(resultObject);
+}
+
+bool ElaBenchmarkReporter::write(const QString& outputPath) const
+{
+    QJsonObject reportObject;
+    reportObject.insert("benchmark", _benchmarkName);
+    reportObject.insert("timestamp", QDateTime::currentDateTimeUtc().toString(Qt::ISODate));
+    reportObject.insert("qtVersion", QString(qVersion()));
+    reportObject.insert("platform", QSysInfo::prettyProductName());
+    reportObject.insert("cpuArchitecture", QSysInfo::currentCpuArchitecture());
+    reportObject.insert("parameters", _parameterObject);
+    reportObject.insert("results", _resultArray);
+    QByteArray reportData = QJsonDocument(reportObject).toJson(QJsonDocument::Indented);
+    if (outputPath.isEmpty())
+    {
+        fwrite(reportData.constData(), 1, reportData.size(), stdout);
+        fflush(stdout);
+        return true;
+    }
+    QFile reportFile(outputPath);
+    if (!reportFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qWarning() << "ElaBenchmarkReporter: cannot write" << outputPath;
+        return false;
+    }
+    reportFile.write(reportData);
+    reportFile.close();
+    return true;
+}
+
+double ElaBenchmarkReporter::elapsedMsec(const QElapsedTimer& timer)
+{
+    return timer.nsecsElapsed() / 1000000.0;
+}
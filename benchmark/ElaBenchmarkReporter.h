@@ -0,0 +1,33 @@
+#ifndef ELABENCHMARKREPORTER_H
+#define ELABENCHMARKREPORTER_H
+
+#include <QElapsedTimer>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QString>
+#include <QVariant>
+#include <QVector>
+
+// 基准结果收集 输出为JSON 便于回归比对
+class ElaBenchmarkReporter
+{
+public:
+    explicit ElaBenchmarkReporter(const QString& benchmarkName);
+    ~ElaBenchmarkReporter();
+
+    void setParameter(const QString& key, const QVariant& value);
+    // 按样本统计 min/mean/median/p95/max
+    void addResult(const QString& resultName, QVector<double> sampleVector, const QString& unit = "ms", const QVariantMap& extraMap = QVariantMap());
+    void addValue(const QString& resultName, double value, const QString& unit, const QVariantMap& extraMap = QVariantMap());
+    // outputPath为空时写入标准输出
+    bool write(const QString& outputPath) const;
+
+    static double elapsedMsec(const QElapsedTimer& timer);
+
+private:
+    QString _benchmarkName;
+    QJsonObject _parameterObject;
+    QJsonArray _resultArray;
+};
+
+#endif // ELABENCHMARKREPORTER_H
@@ -0,0 +1,362 @@
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QDataStream>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QFile>
+#include <QFileInfo>
+#include <QImage>
+#include <QPainter>
+#include <QRandomGenerator>
+#include <QTemporaryDir>
+#include <QtMath>
+#include <functional>
+
+#include "ElaApplication.h"
+#include "ElaBenchmarkReporter.h"
+#include "ElaGraphicsItem.h"
+#include "ElaGraphicsScene.h"
+#include "ElaGraphicsView.h"
+
+// ElaGraphicsScene/ElaGraphicsView 规模基准 离屏运行 结果以JSON输出
+struct ElaGraphicsBenchmarkConfig
+{
+    int itemCount{5000};
+    int linkCount{5000};
+    int iterations{5};
+    int queryCount{2000};
+    int frameCount{60};
+    quint32 seed{20240101};
+    QSize viewSize{1280, 720};
+};
+
+static QRectF createSceneRect(int itemCount)
+{
+    // 平均每个图元占据约120x120的区域
+    qreal sideLength = qMax<qreal>(1000, qSqrt(itemCount) * 120);
+    return QRectF(0, 0, sideLength, sideLength);
+}
+
+static QList<ElaGraphicsItem*> createSyntheticItems(ElaGraphicsScene* scene, const ElaGraphicsBenchmarkConfig& config, QRandomGenerator& random)
+{
+    QList<ElaGraphicsItem*> itemList = scene->createAndAddItem(50, 50, config.itemCount);
+    QRectF sceneRect = scene->sceneRect();
+    for (auto item : itemList)
+    {
+        item->setPos(sceneRect.left() + random.bounded(sceneRect.width()), sceneRect.top() + random.bounded(sceneRect.height()));
+    }
+    return itemList;
+}
+
+static void createSyntheticLinks(ElaGraphicsScene* scene, const QList<ElaGraphicsItem*>& itemList, const ElaGraphicsBenchmarkConfig& config, QRandomGenerator& random)
+{
+    if (itemList.count() < 2)
+    {
+        return;
+    }
+    for (int i = 0; i < config.linkCount; i++)
+    {
+        ElaGraphicsItem* item1 = itemList[random.bounded(itemList.count())];
+        ElaGraphicsItem* item2 = itemList[random.bounded(itemList.count())];
+        scene->addItemLink(item1, item2);
+    }
+}
+
+// 按版本2之前的布局写出场景 图元逐个内联两张图片 用于与当前格式对比体积和加载耗时
+static bool writeLegacyScene(ElaGraphicsScene* scene, const QString& filePath)
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return false;
+    }
+    QDataStream stream(&file);
+    QList<ElaGraphicsItem*> itemList = scene->getElaItems();
+    QStringList keyList;
+    keyList.reserve(itemList.count());
+    for (auto item : itemList)
+    {
+        keyList.append(item->getItemUID());
+    }
+    stream << keyList;
+    for (auto item : itemList)
+    {
+        QVector<bool> linkPortStateVector(item->getMaxLinkPortCount(), false);
+        for (auto port : item->getUsedLinkPort())
+        {
+            linkPortStateVector[port] = true;
+        }
+        stream << item->x() << item->y() << item->zValue() << item->getWidth() << item->getHeight();
+        stream << item->getItemUID() << item->getItemName() << item->getMaxLinkPortCount() << linkPortStateVector << item->getDataRoutes();
+        stream << item->getItemImage() << item->getItemSelectedImage();
+    }
+    stream << scene->getItemLinkList();
+    return stream.status() == QDataStream::Ok;
+}
+
+static QVector<double> measureFrames(ElaGraphicsView* view, QImage& frameImage, int frameCount, const std::function<void(int)>& prepareFrame)
+{
+    QVector<double> sampleVector;
+    sampleVector.reserve(frameCount);
+    for (int i = 0; i < frameCount; i++)
+    {
+        prepareFrame(i);
+        QElapsedTimer frameTimer;
+        frameTimer.start();
+        frameImage.fill(Qt::white);
+        QPainter painter(&frameImage);
+        painter.setRenderHints(view->renderHints());
+        view->QGraphicsView::render(&painter);
+        painter.end();
+        sampleVector.append(ElaBenchmarkReporter::elapsedMsec(frameTimer));
+    }
+    return sampleVector;
+}
+
+static QString getIndexModeName(ElaGraphicsSceneType::ItemIndexMode mode)
+{
+    switch (mode)
+    {
+    case ElaGraphicsSceneType::BspTreeIndex:
+    {
+        return "bsp";
+    }
+    case ElaGraphicsSceneType::GridIndex:
+    {
+        return "grid";
+    }
+    default:
+    {
+        return "none";
+    }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+    {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication a(argc, argv);
+    eApp->init();
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("ElaGraphicsScene/ElaGraphicsView benchmark");
+    parser.addHelpOption();
+    QCommandLineOption itemOption("items", "Item count.", "count", "5000");
+    QCommandLineOption linkOption("links", "Link count.", "count", "5000");
+    QCommandLineOption iterationOption("iterations", "Iterations per measurement.", "count", "5");
+    QCommandLineOption queryOption("queries", "Hit-test queries per index mode.", "count", "2000");
+    QCommandLineOption frameOption("frames", "Frames per pan/zoom measurement.", "count", "60");
+    QCommandLineOption seedOption("seed", "Random layout seed.", "seed", "20240101");
+    QCommandLineOption outputOption({"o", "output"}, "Write JSON report to file instead of stdout.", "path");
+    parser.addOptions({itemOption, linkOption, iterationOption, queryOption, frameOption, seedOption, outputOption});
+    parser.process(a);
+
+    ElaGraphicsBenchmarkConfig config;
+    config.itemCount = qMax(1, parser.value(itemOption).toInt());
+    config.linkCount = qMax(0, parser.value(linkOption).toInt());
+    config.iterations = qMax(1, parser.value(iterationOption).toInt());
+    config.queryCount = qMax(1, parser.value(queryOption).toInt());
+    config.frameCount = qMax(1, parser.value(frameOption).toInt());
+    config.seed = parser.value(seedOption).toUInt();
+
+    ElaBenchmarkReporter reporter("ElaGraphicsBenchmark");
+    reporter.setParameter("items", config.itemCount);
+    reporter.setParameter("links", config.linkCount);
+    reporter.setParameter("iterations", config.iterations);
+    reporter.setParameter("queries", config.queryCount);
+    reporter.setParameter("frames", config.frameCount);
+    reporter.setParameter("seed", config.seed);
+    reporter.setParameter("viewWidth", config.viewSize.width());
+    reporter.setParameter("viewHeight", config.viewSize.height());
+
+    QRandomGenerator random(config.seed);
+    QRectF sceneRect = createSceneRect(config.itemCount);
+
+    // 添加 连接 移除
+    QVector<double> addSampleVector;
+    QVector<double> linkSampleVector;
+    QVector<double> removeSampleVector;
+    for (int i = 0; i < config.iterations; i++)
+    {
+        ElaGraphicsScene scene;
+        scene.setSceneRect(sceneRect);
+        QElapsedTimer timer;
+        timer.start();
+        QList<ElaGraphicsItem*> itemList = createSyntheticItems(&scene, config, random);
+        addSampleVector.append(ElaBenchmarkReporter::elapsedMsec(timer));
+        timer.restart();
+        createSyntheticLinks(&scene, itemList, config, random);
+        linkSampleVector.append(ElaBenchmarkReporter::elapsedMsec(timer));
+        timer.restart();
+        scene.removeItems(itemList);
+        removeSampleVector.append(ElaBenchmarkReporter::elapsedMsec(timer));
+    }
+    reporter.addResult("add_items", addSampleVector);
+    reporter.addResult("add_links", linkSampleVector);
+    reporter.addResult("remove_items", removeSampleVector);
+
+    ElaGraphicsScene scene;
+    scene.setSceneRect(sceneRect);
+    QList<ElaGraphicsItem*> itemList = createSyntheticItems(&scene, config, random);
+    createSyntheticLinks(&scene, itemList, config, random);
+
+    // 命中测试
+    for (auto mode : {ElaGraphicsSceneType::NoIndex, ElaGraphicsSceneType::BspTreeIndex, ElaGraphicsSceneType::GridIndex})
+    {
+        QElapsedTimer timer;
+        timer.start();
+        scene.setItemIndexMode(mode);
+        reporter.addValue(QString("index_build_%1").arg(getIndexModeName(mode)), ElaBenchmarkReporter::elapsedMsec(timer), "ms");
+        QVector<double> pointSampleVector;
+        QVector<double> rectSampleVector;
+        for (int i = 0; i < config.iterations; i++)
+        {
+            timer.restart();
+            for (int j = 0; j < config.queryCount; j++)
+            {
+                scene.getElaItems(QPointF(random.bounded(sceneRect.width()), random.bounded(sceneRect.height())));
+            }
+            pointSampleVector.append(ElaBenchmarkReporter::elapsedMsec(timer) * 1000 / config.queryCount);
+            timer.restart();
+            for (int j = 0; j < config.queryCount; j++)
+            {
+                scene.getElaItems(QRectF(random.bounded(sceneRect.width()), random.bounded(sceneRect.height()), 400, 400));
+            }
+            rectSampleVector.append(ElaBenchmarkReporter::elapsedMsec(timer) * 1000 / config.queryCount);
+        }
+        reporter.addResult(QString("hit_test_point_%1").arg(getIndexModeName(mode)), pointSampleVector, "us");
+        reporter.addResult(QString("hit_test_rect_%1").arg(getIndexModeName(mode)), rectSampleVector, "us");
+    }
+    scene.setItemIndexMode(ElaGraphicsSceneType::NoIndex);
+
+    // 平移 缩放帧耗时
+    ElaGraphicsView view(&scene);
+    view.resize(config.viewSize);
+    view.show();
+    QApplication::processEvents();
+    QImage frameImage(view.viewport()->size(), QImage::Format_ARGB32_Premultiplied);
+    reporter.addResult("pan_frame", measureFrames(&view, frameImage, config.frameCount, [&](int) {
+                           view.centerOn(random.bounded(sceneRect.width()), random.bounded(sceneRect.height()));
+                       }));
+    for (qreal zoomScale : {1.0, 0.5, 0.25, 0.15})
+    {
+        view.setTransform(QTransform::fromScale(zoomScale, zoomScale));
+        reporter.addResult(QString("zoom_frame_%1").arg(zoomScale), measureFrames(&view, frameImage, config.frameCount, [&](int) {
+                               view.centerOn(sceneRect.center() + QPointF(random.bounded(200.0) - 100, random.bounded(200.0) - 100));
+                           }),
+                           "ms", {{"scale", zoomScale}});
+    }
+    view.resetTransform();
+
+    // 拖动带连接的图元 每帧移动一批图元并绘制 移动耗时含连线路径更新 帧耗时另含离屏绘制
+    QList<ElaGraphicsItem*> linkedItemList;
+    for (auto item : itemList)
+    {
+        if (scene.getItemLinkCount(item) > 0)
+        {
+            linkedItemList.append(item);
+            if (linkedItemList.count() == 50)
+            {
+                break;
+            }
+        }
+    }
+    if (!linkedItemList.isEmpty())
+    {
+        view.centerOn(linkedItemList.first());
+    }
+    QVector<double> dragMoveSampleVector;
+    QVector<double> dragFrameSampleVector;
+    dragMoveSampleVector.reserve(config.frameCount);
+    dragFrameSampleVector.reserve(config.frameCount);
+    for (int i = 0; i < config.frameCount; i++)
+    {
+        QPointF moveDelta(i % 2 ? 5 : -5, i % 2 ? -5 : 5);
+        QElapsedTimer timer;
+        timer.start();
+        for (auto item : linkedItemList)
+        {
+            item->moveBy(moveDelta.x(), moveDelta.y());
+        }
+        dragMoveSampleVector.append(ElaBenchmarkReporter::elapsedMsec(timer));
+        frameImage.fill(Qt::white);
+        QPainter painter(&frameImage);
+        painter.setRenderHints(view.renderHints());
+        view.QGraphicsView::render(&painter);
+        painter.end();
+        dragFrameSampleVector.append(ElaBenchmarkReporter::elapsedMsec(timer));
+    }
+    reporter.addResult("drag_move_linked", dragMoveSampleVector, "ms", {{"movedItems", linkedItemList.count()}});
+    reporter.addResult("drag_frame_linked", dragFrameSampleVector, "ms", {{"movedItems", linkedItemList.count()}});
+    view.hide();
+
+    // 序列化 反序列化
+    QTemporaryDir tempDir;
+    scene.setSerializePath(tempDir.filePath("benchmark_scene.bin"));
+    QVector<double> serializeSampleVector;
+    QVector<double> deserializeSampleVector;
+    QVector<double> asyncDeserializeSampleVector;
+    QVector<double> asyncBatchSampleVector;
+    for (int i = 0; i < config.iterations; i++)
+    {
+        QElapsedTimer timer;
+        timer.start();
+        scene.serialize();
+        serializeSampleVector.append(ElaBenchmarkReporter::elapsedMsec(timer));
+
+        ElaGraphicsScene loadScene;
+        loadScene.setSerializePath(scene.getSerializePath());
+        timer.restart();
+        loadScene.deserialize();
+        deserializeSampleVector.append(ElaBenchmarkReporter::elapsedMsec(timer));
+
+        // 异步加载 同时记录两次进度之间的最长间隔 即GUI线程单次最长占用
+        ElaGraphicsScene asyncScene;
+        asyncScene.setSerializePath(scene.getSerializePath());
+        QEventLoop eventLoop;
+        // 首个间隔包含工作线程解析的等待时间 不计入
+        QElapsedTimer batchTimer;
+        double maxBatchMsec = 0;
+        QObject::connect(&asyncScene, &ElaGraphicsScene::deserializeProgress, [&](int, int) {
+            if (batchTimer.isValid())
+            {
+                maxBatchMsec = qMax(maxBatchMsec, ElaBenchmarkReporter::elapsedMsec(batchTimer));
+            }
+            batchTimer.start();
+        });
+        QObject::connect(&asyncScene, &ElaGraphicsScene::deserializeFinished, &eventLoop, &QEventLoop::quit);
+        timer.restart();
+        asyncScene.deserializeAsync();
+        eventLoop.exec();
+        asyncDeserializeSampleVector.append(ElaBenchmarkReporter::elapsedMsec(timer));
+        asyncBatchSampleVector.append(maxBatchMsec);
+    }
+    reporter.addValue("serialized_bytes_v2", QFileInfo(scene.getSerializePath()).size(), "bytes");
+
+    // 旧格式对照
+    QString legacyPath = tempDir.filePath("benchmark_scene_legacy.bin");
+    QVector<double> legacyDeserializeSampleVector;
+    if (writeLegacyScene(&scene, legacyPath))
+    {
+        reporter.addValue("serialized_bytes_legacy", QFileInfo(legacyPath).size(), "bytes");
+        for (int i = 0; i < config.iterations; i++)
+        {
+            ElaGraphicsScene loadScene;
+            loadScene.setSerializePath(legacyPath);
+            QElapsedTimer timer;
+            timer.start();
+            loadScene.deserialize();
+            legacyDeserializeSampleVector.append(ElaBenchmarkReporter::elapsedMsec(timer));
+        }
+        reporter.addResult("deserialize_legacy", legacyDeserializeSampleVector);
+    }
+    reporter.addResult("serialize", serializeSampleVector);
+    reporter.addResult("deserialize", deserializeSampleVector);
+    reporter.addResult("deserialize_async_total", asyncDeserializeSampleVector);
+    reporter.addResult("deserialize_async_max_batch", asyncBatchSampleVector);
+
+    return reporter.write(parser.value(outputOption)) ? 0 : 1;
+}
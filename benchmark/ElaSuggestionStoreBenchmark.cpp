@@ -0,0 +1,169 @@
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QVariantMap>
+#include <QVector>
+
+#include "ElaApplication.h"
+#include "ElaBenchmarkReporter.h"
+#include "ElaSuggestBox.h"
+#ifdef Q_OS_WIN
+#include <Windows.h>
+#include <psapi.h>
+#endif
+
+// 建议项内存占用 以常驻内存增量计 Qt容器经malloc分配 替换operator new无法统计
+// 对照组按旧版每条建议一个QObject的布局构造 与ElaSuggestionStore的列式存储比较
+struct ElaSuggestionStoreBenchmarkConfig
+{
+    int entryCount{100000};
+    int distinctCount{100000};
+    int dataInterval{10};
+    int iterations{3};
+};
+
+// 旧版ElaSuggestion的等价布局
+class ElaLegacySuggestion : public QObject
+{
+public:
+    explicit ElaLegacySuggestion(QObject* parent = nullptr)
+        : QObject(parent)
+    {
+    }
+    ElaIconType::IconName elaIcon{ElaIconType::None};
+    QString suggestText;
+    QVariantMap suggestData;
+};
+
+// 当前进程常驻内存 单位字节 不支持的平台返回-1
+static qint64 currentResidentBytes()
+{
+#if defined(Q_OS_WIN)
+    PROCESS_MEMORY_COUNTERS memoryCounters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &memoryCounters, sizeof(memoryCounters)))
+    {
+        return qint64(memoryCounters.WorkingSetSize);
+    }
+    return -1;
+#elif defined(Q_OS_LINUX)
+    QFile statusFile("/proc/self/status");
+    if (!statusFile.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+        return -1;
+    }
+    while (!statusFile.atEnd())
+    {
+        QByteArray line = statusFile.readLine();
+        if (line.startsWith("VmRSS:"))
+        {
+            return line.mid(6).trimmed().split(' ').first().toLongLong() * 1024;
+        }
+    }
+    return -1;
+#else
+    return -1;
+#endif
+}
+
+static QString suggestText(int index, const ElaSuggestionStoreBenchmarkConfig& config)
+{
+    return QString("ElaSuggestion Entry %1").arg(index % config.distinctCount);
+}
+
+static QVariantMap suggestData(int index, const ElaSuggestionStoreBenchmarkConfig& config)
+{
+    if (config.dataInterval <= 0 || index % config.dataInterval != 0)
+    {
+        return {};
+    }
+    return {{"index", index}};
+}
+
+int main(int argc, char* argv[])
+{
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+    {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication a(argc, argv);
+    eApp->init();
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("ElaSuggestionStore memory benchmark");
+    parser.addHelpOption();
+    QCommandLineOption entryOption("entries", "Suggestion entries.", "count", "100000");
+    QCommandLineOption distinctOption("distinct", "Distinct suggestion texts.", "count", "100000");
+    QCommandLineOption dataOption("data-interval", "Attach suggestData to every Nth entry, 0 for none.", "count", "10");
+    QCommandLineOption iterationOption("iterations", "Iterations.", "count", "3");
+    QCommandLineOption outputOption({"o", "output"}, "Write JSON report to file instead of stdout.", "path");
+    parser.addOptions({entryOption, distinctOption, dataOption, iterationOption, outputOption});
+    parser.process(a);
+
+    ElaSuggestionStoreBenchmarkConfig config;
+    config.entryCount = qMax(1, parser.value(entryOption).toInt());
+    config.distinctCount = qBound(1, parser.value(distinctOption).toInt(), config.entryCount);
+    config.dataInterval = qMax(0, parser.value(dataOption).toInt());
+    config.iterations = qMax(1, parser.value(iterationOption).toInt());
+
+    ElaBenchmarkReporter reporter("ElaSuggestionStoreBenchmark");
+    reporter.setParameter("entries", config.entryCount);
+    reporter.setParameter("distinct", config.distinctCount);
+    reporter.setParameter("dataInterval", config.dataInterval);
+    reporter.setParameter("iterations", config.iterations);
+
+    QVector<double> storeTimeVector;
+    QVector<double> legacyTimeVector;
+    qint64 storeBytes = -1;
+    qint64 legacyBytes = -1;
+    for (int iteration = 0; iteration < config.iterations; iteration++)
+    {
+        // 常驻内存仅在首轮统计 两组同时存活 避免复用对方释放的内存
+        bool isMeasureMemory = iteration == 0;
+        // 列式存储 经公开接口写入
+        ElaSuggestBox* suggestBox = new ElaSuggestBox();
+        qint64 baseBytes = currentResidentBytes();
+        QElapsedTimer timer;
+        timer.start();
+        for (int i = 0; i < config.entryCount; i++)
+        {
+            suggestBox->addSuggestion(ElaIconType::IconName(0xe800 + i % 256), suggestText(i, config), suggestData(i, config));
+        }
+        storeTimeVector.append(ElaBenchmarkReporter::elapsedMsec(timer));
+        if (isMeasureMemory && baseBytes >= 0)
+        {
+            storeBytes = currentResidentBytes() - baseBytes;
+        }
+
+        // 旧版布局对照
+        baseBytes = currentResidentBytes();
+        QObject* legacyParent = new QObject();
+        timer.restart();
+        for (int i = 0; i < config.entryCount; i++)
+        {
+            ElaLegacySuggestion* suggestion = new ElaLegacySuggestion(legacyParent);
+            suggestion->elaIcon = ElaIconType::IconName(0xe800 + i % 256);
+            suggestion->suggestText = suggestText(i, config);
+            suggestion->suggestData = suggestData(i, config);
+        }
+        legacyTimeVector.append(ElaBenchmarkReporter::elapsedMsec(timer));
+        if (isMeasureMemory && baseBytes >= 0)
+        {
+            legacyBytes = currentResidentBytes() - baseBytes;
+        }
+        delete legacyParent;
+        delete suggestBox;
+    }
+    reporter.addResult("store_append", storeTimeVector, "ms");
+    reporter.addResult("legacy_append", legacyTimeVector, "ms");
+    if (storeBytes < 0)
+    {
+        reporter.addValue("resident_bytes_unavailable", 1, "bool");
+    }
+    else
+    {
+        reporter.addValue("store_resident", storeBytes, "bytes", {{"bytesPerEntry", double(storeBytes) / config.entryCount}});
+        reporter.addValue("legacy_resident", legacyBytes, "bytes", {{"bytesPerEntry", double(legacyBytes) / config.entryCount}});
+    }
+    return reporter.write(parser.value(outputOption)) ? 0 : 1;
+}
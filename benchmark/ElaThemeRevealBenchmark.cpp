@@ -0,0 +1,155 @@
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QEasingCurve>
+#include <QElapsedTimer>
+#include <QImage>
+#include <QLinearGradient>
+#include <QPainter>
+#include <QPainterPath>
+#include <QPixmap>
+#include <QtMath>
+
+#include "ElaApplication.h"
+#include "ElaBenchmarkReporter.h"
+#include "ElaThemeAnimationWidget.h"
+
+// 主题切换圆形揭示动画的逐帧绘制开销 离屏运行 结果以JSON输出
+struct ElaThemeRevealBenchmarkConfig
+{
+    QSize windowSize{1920, 1080};
+    qreal devicePixelRatio{1.0};
+    int frameCount{60};
+    int iterations{5};
+};
+
+static QPixmap createBackground(const ElaThemeRevealBenchmarkConfig& config, const QColor& startColor, const QColor& endColor)
+{
+    QPixmap background(config.windowSize * config.devicePixelRatio);
+    background.setDevicePixelRatio(config.devicePixelRatio);
+    QPainter painter(&background);
+    QLinearGradient gradient(0, 0, config.windowSize.width(), config.windowSize.height());
+    gradient.setColorAt(0, startColor);
+    gradient.setColorAt(1, endColor);
+    painter.fillRect(QRect(QPoint(0, 0), config.windowSize), gradient);
+    return background;
+}
+
+static QVector<qreal> createRadiusVector(const ElaThemeRevealBenchmarkConfig& config, QPoint center)
+{
+    qreal endRadius = 0;
+    for (const QPoint& corner : {QPoint(0, 0), QPoint(config.windowSize.width(), 0), QPoint(0, config.windowSize.height()), QPoint(config.windowSize.width(), config.windowSize.height())})
+    {
+        endRadius = qMax(endRadius, qSqrt(qPow(corner.x() - center.x(), 2) + qPow(corner.y() - center.y(), 2)));
+    }
+    QEasingCurve easingCurve(QEasingCurve::InOutSine);
+    QVector<qreal> radiusVector;
+    radiusVector.reserve(config.frameCount);
+    for (int i = 1; i <= config.frameCount; i++)
+    {
+        radiusVector.append(endRadius * easingCurve.valueForProgress(static_cast<qreal>(i) / config.frameCount));
+    }
+    return radiusVector;
+}
+
+int main(int argc, char* argv[])
+{
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+    {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication a(argc, argv);
+    eApp->init();
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("ElaWidgetTools theme reveal animation benchmark");
+    parser.addHelpOption();
+    QCommandLineOption widthOption("width", "Window width in logical pixels.", "pixels", "1920");
+    QCommandLineOption heightOption("height", "Window height in logical pixels.", "pixels", "1080");
+    QCommandLineOption dprOption("dpr", "Device pixel ratio of the window grabs.", "ratio", "1");
+    QCommandLineOption frameOption("frames", "Frames per reveal.", "count", "60");
+    QCommandLineOption iterationOption("iterations", "Reveals per mode.", "count", "5");
+    QCommandLineOption outputOption({"o", "output"}, "Write JSON report to file instead of stdout.", "path");
+    parser.addOptions({widthOption, heightOption, dprOption, frameOption, iterationOption, outputOption});
+    parser.process(a);
+
+    ElaThemeRevealBenchmarkConfig config;
+    config.windowSize = QSize(qMax(1, parser.value(widthOption).toInt()), qMax(1, parser.value(heightOption).toInt()));
+    config.devicePixelRatio = qMax(0.5, parser.value(dprOption).toDouble());
+    config.frameCount = qMax(1, parser.value(frameOption).toInt());
+    config.iterations = qMax(1, parser.value(iterationOption).toInt());
+
+    ElaBenchmarkReporter reporter("ElaThemeRevealBenchmark");
+    reporter.setParameter("width", config.windowSize.width());
+    reporter.setParameter("height", config.windowSize.height());
+    reporter.setParameter("devicePixelRatio", config.devicePixelRatio);
+    reporter.setParameter("frames", config.frameCount);
+    reporter.setParameter("iterations", config.iterations);
+
+    // 揭示中心取主题切换按钮所在的右上角
+    QPoint center(config.windowSize.width() - 100, 20);
+    QVector<qreal> radiusVector = createRadiusVector(config, center);
+    QPixmap oldBackground = createBackground(config, QColor(0xF3, 0xF3, 0xF3), QColor(0xE0, 0xE8, 0xF0));
+    QPixmap newBackground = createBackground(config, QColor(0x20, 0x20, 0x20), QColor(0x2C, 0x34, 0x40));
+    QPixmap renderTarget(config.windowSize * config.devicePixelRatio);
+    renderTarget.setDevicePixelRatio(config.devicePixelRatio);
+
+    // 改动前的实现 整窗QImage绘制两次并做抗锯齿路径裁剪 作为对照
+    QImage oldImage = oldBackground.toImage();
+    QImage newImage = newBackground.toImage();
+    QVector<double> legacySampleVector;
+    for (int iteration = 0; iteration < config.iterations; iteration++)
+    {
+        for (qreal radius : radiusVector)
+        {
+            QElapsedTimer timer;
+            timer.start();
+            QPainter painter(&renderTarget);
+            painter.setRenderHints(QPainter::Antialiasing);
+            painter.setPen(Qt::NoPen);
+            painter.drawImage(QRect(QPoint(0, 0), config.windowSize), oldImage);
+            QPainterPath path;
+            path.addEllipse(QPointF(center), radius, radius);
+            painter.setClipPath(path);
+            painter.drawImage(QRect(QPoint(0, 0), config.windowSize), newImage);
+            painter.end();
+            legacySampleVector.append(ElaBenchmarkReporter::elapsedMsec(timer));
+        }
+    }
+    reporter.addResult("frame_legacy", legacySampleVector, "ms", {{"mode", "legacy"}});
+
+    ElaThemeAnimationWidget animationWidget;
+    animationWidget.resize(config.windowSize);
+    animationWidget.setCenter(center);
+    animationWidget.setOldWindowBackground(oldBackground);
+    animationWidget.setNewWindowBackground(newBackground);
+    for (bool isIncremental : {false, true})
+    {
+        QVector<double> sampleVector;
+        qint64 paintedPixelCount = 0;
+        for (int iteration = 0; iteration < config.iterations; iteration++)
+        {
+            animationWidget.setRadius(0);
+            animationWidget.render(&renderTarget, QPoint(), QRegion(animationWidget.rect()), QWidget::DrawChildren);
+            qreal lastRadius = 0;
+            for (qreal radius : radiusVector)
+            {
+                QRegion paintRegion = isIncremental ? animationWidget.getRevealRegion(lastRadius, radius) : QRegion(animationWidget.rect());
+                for (const QRect& paintRect : paintRegion)
+                {
+                    paintedPixelCount += static_cast<qint64>(paintRect.width()) * paintRect.height();
+                }
+                QElapsedTimer timer;
+                timer.start();
+                animationWidget.setRadius(radius);
+                animationWidget.render(&renderTarget, QPoint(), paintRegion, QWidget::DrawChildren);
+                sampleVector.append(ElaBenchmarkReporter::elapsedMsec(timer));
+                lastRadius = radius;
+            }
+        }
+        QString modeName = isIncremental ? "incremental" : "full";
+        reporter.addResult(QString("frame_%1").arg(modeName), sampleVector, "ms",
+                           {{"mode", modeName},
+                            {"paintedPixelsPerFrame", static_cast<double>(paintedPixelCount) / sampleVector.count()}});
+    }
+    return reporter.write(parser.value(outputOption)) ? 0 : 1;
+}
@@ -0,0 +1,330 @@
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QImage>
+#include <QRegularExpression>
+#include <QStandardItemModel>
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <new>
+
+#include "ElaAcrylicUrlCard.h"
+#include "ElaApplication.h"
+#include "ElaBenchmarkReporter.h"
+#include "ElaBreadcrumbBar.h"
+#include "ElaCalendar.h"
+#include "ElaCalendarPicker.h"
+#include "ElaCheckBox.h"
+#include "ElaColorDialog.h"
+#include "ElaComboBox.h"
+#include "ElaDoubleSpinBox.h"
+#include "ElaGraphicsView.h"
+#include "ElaIconButton.h"
+#include "ElaImageCard.h"
+#include "ElaInteractiveCard.h"
+#include "ElaLineEdit.h"
+#include "ElaListView.h"
+#include "ElaMenu.h"
+#include "ElaMenuBar.h"
+#include "ElaMessageButton.h"
+#include "ElaMultiSelectComboBox.h"
+#include "ElaNavigationBar.h"
+#include "ElaPivot.h"
+#include "ElaPlainTextEdit.h"
+#include "ElaPopularCard.h"
+#include "ElaProgressBar.h"
+#include "ElaPromotionCard.h"
+#include "ElaPushButton.h"
+#include "ElaRadioButton.h"
+#include "ElaReminderCard.h"
+#include "ElaScrollArea.h"
+#include "ElaScrollBar.h"
+#include "ElaScrollPageArea.h"
+#include "ElaSlider.h"
+#include "ElaSpinBox.h"
+#include "ElaStatusBar.h"
+#include "ElaSuggestBox.h"
+#include "ElaTabBar.h"
+#include "ElaTabWidget.h"
+#include "ElaTableView.h"
+#include "ElaText.h"
+#include "ElaTheme.h"
+#include "ElaToggleButton.h"
+#include "ElaToggleSwitch.h"
+#include "ElaToolBar.h"
+#include "ElaToolButton.h"
+#include "ElaTreeView.h"
+#include "ElaWidget.h"
+#include "ElaWindow.h"
+
+// 通过替换全局operator new统计分配次数
+// Qt容器经malloc分配 不在统计范围内 Windows下各DLL使用独立的分配器 仅统计本程序与静态库内的分配
+static std::atomic<quint64> allocationCount{0};
+static std::atomic<quint64> allocationBytes{0};
+
+void* operator new(std::size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocationBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+struct ElaWidgetFactory
+{
+    QString widgetName;
+    QSize widgetSize;
+    std::function<QWidget*()> createWidget;
+};
+
+static QStandardItemModel* createItemModel(QObject* parent, int rowCount, int columnCount)
+{
+    QStandardItemModel* model = new QStandardItemModel(rowCount, columnCount, parent);
+    for (int row = 0; row < rowCount; row++)
+    {
+        for (int column = 0; column < columnCount; column++)
+        {
+            model->setItem(row, column, new QStandardItem(QString("Item %1-%2").arg(row).arg(column)));
+        }
+    }
+    return model;
+}
+
+static QVector<ElaWidgetFactory> createWidgetFactoryVector()
+{
+    // 尺寸为空时使用sizeHint
+    QVector<ElaWidgetFactory> factoryVector;
+    factoryVector.append({"ElaPushButton", QSize(), []() { return new ElaPushButton("ElaPushButton"); }});
+    factoryVector.append({"ElaToggleButton", QSize(), []() { return new ElaToggleButton("ElaToggleButton"); }});
+    factoryVector.append({"ElaToggleSwitch", QSize(), []() { return new ElaToggleSwitch(); }});
+    factoryVector.append({"ElaToolButton", QSize(), []() {
+                              ElaToolButton* widget = new ElaToolButton();
+                              widget->setElaIcon(ElaIconType::Broom);
+                              widget->setText("ElaToolButton");
+                              widget->setToolButtonStyle(Qt::ToolButtonTextBesideIcon);
+                              return widget;
+                          }});
+    factoryVector.append({"ElaIconButton", QSize(36, 36), []() { return new ElaIconButton(ElaIconType::Broom); }});
+    factoryVector.append({"ElaMessageButton", QSize(), []() { return new ElaMessageButton("ElaMessageButton"); }});
+    factoryVector.append({"ElaCheckBox", QSize(), []() { return new ElaCheckBox("ElaCheckBox"); }});
+    factoryVector.append({"ElaRadioButton", QSize(), []() { return new ElaRadioButton("ElaRadioButton"); }});
+    factoryVector.append({"ElaLineEdit", QSize(240, 35), []() {
+                              ElaLineEdit* widget = new ElaLineEdit();
+                              widget->setText("ElaLineEdit");
+                              return widget;
+                          }});
+    factoryVector.append({"ElaPlainTextEdit", QSize(300, 150), []() {
+                              ElaPlainTextEdit* widget = new ElaPlainTextEdit();
+                              widget->setPlainText(QString("ElaPlainTextEdit\n").repeated(20));
+                              return widget;
+                          }});
+    factoryVector.append({"ElaComboBox", QSize(), []() {
+                              ElaComboBox* widget = new ElaComboBox();
+                              widget->addItems({"Item1", "Item2", "Item3"});
+                              return widget;
+                          }});
+    factoryVector.append({"ElaMultiSelectComboBox", QSize(240, 35), []() {
+                              ElaMultiSelectComboBox* widget = new ElaMultiSelectComboBox();
+                              widget->addItems({"Item1", "Item2", "Item3"});
+                              return widget;
+                          }});
+    factoryVector.append({"ElaSpinBox", QSize(), []() { return new ElaSpinBox(); }});
+    factoryVector.append({"ElaDoubleSpinBox", QSize(), []() { return new ElaDoubleSpinBox(); }});
+    factoryVector.append({"ElaSlider", QSize(240, 30), []() {
+                              ElaSlider* widget = new ElaSlider(Qt::Horizontal);
+                              widget->setValue(40);
+                              return widget;
+                          }});
+    factoryVector.append({"ElaProgressBar", QSize(240, 20), []() {
+                              ElaProgressBar* widget = new ElaProgressBar();
+                              widget->setValue(60);
+                              return widget;
+                          }});
+    factoryVector.append({"ElaScrollBar", QSize(12, 300), []() { return new ElaScrollBar(Qt::Vertical); }});
+    factoryVector.append({"ElaText", QSize(), []() { return new ElaText("ElaText"); }});
+    factoryVector.append({"ElaBreadcrumbBar", QSize(400, 40), []() {
+                              ElaBreadcrumbBar* widget = new ElaBreadcrumbBar();
+                              widget->setBreadcrumbList({"Home", "Library", "Data", "Detail"});
+                              return widget;
+                          }});
+    factoryVector.append({"ElaPivot", QSize(400, 40), []() {
+                              ElaPivot* widget = new ElaPivot();
+                              widget->appendPivot("Pivot1");
+                              widget->appendPivot("Pivot2");
+                              widget->appendPivot("Pivot3");
+                              return widget;
+                          }});
+    factoryVector.append({"ElaTabBar", QSize(400, 40), []() {
+                              ElaTabBar* widget = new ElaTabBar();
+                              widget->addTab("Tab1");
+                              widget->addTab("Tab2");
+                              widget->addTab("Tab3");
+                              return widget;
+                          }});
+    factoryVector.append({"ElaTabWidget", QSize(500, 300), []() {
+                              ElaTabWidget* widget = new ElaTabWidget();
+                              widget->addTab(new QWidget(), "Tab1");
+                              widget->addTab(new QWidget(), "Tab2");
+                              return widget;
+                          }});
+    factoryVector.append({"ElaListView", QSize(300, 400), []() {
+                              ElaListView* widget = new ElaListView();
+                              widget->setModel(createItemModel(widget, 100, 1));
+                              return widget;
+                          }});
+    factoryVector.append({"ElaTableView", QSize(500, 400), []() {
+                              ElaTableView* widget = new ElaTableView();
+                              widget->setModel(createItemModel(widget, 100, 5));
+                              return widget;
+                          }});
+    factoryVector.append({"ElaTreeView", QSize(300, 400), []() {
+                              ElaTreeView* widget = new ElaTreeView();
+                              widget->setModel(createItemModel(widget, 100, 1));
+                              return widget;
+                          }});
+    factoryVector.append({"ElaScrollArea", QSize(300, 300), []() { return new ElaScrollArea(); }});
+    factoryVector.append({"ElaScrollPageArea", QSize(400, 80), []() { return new ElaScrollPageArea(); }});
+    factoryVector.append({"ElaMenuBar", QSize(400, 30), []() {
+                              ElaMenuBar* widget = new ElaMenuBar();
+                              widget->addMenu("File");
+                              widget->addMenu("Edit");
+                              return widget;
+                          }});
+    factoryVector.append({"ElaMenu", QSize(), []() {
+                              ElaMenu* widget = new ElaMenu();
+                              widget->addElaIconAction(ElaIconType::Broom, "Action1");
+                              widget->addElaIconAction(ElaIconType::Copy, "Action2");
+                              widget->addSeparator();
+                              widget->addElaIconAction(ElaIconType::Paste, "Action3");
+                              return widget;
+                          }});
+    factoryVector.append({"ElaToolBar", QSize(400, 40), []() {
+                              ElaToolBar* widget = new ElaToolBar();
+                              widget->addAction("Action1");
+                              widget->addAction("Action2");
+                              return widget;
+                          }});
+    factoryVector.append({"ElaStatusBar", QSize(600, 30), []() { return new ElaStatusBar(); }});
+    factoryVector.append({"ElaSuggestBox", QSize(), []() { return new ElaSuggestBox(); }});
+    factoryVector.append({"ElaCalendar", QSize(), []() { return new ElaCalendar(); }});
+    factoryVector.append({"ElaCalendarPicker", QSize(), []() { return new ElaCalendarPicker(); }});
+    factoryVector.append({"ElaAcrylicUrlCard", QSize(), []() { return new ElaAcrylicUrlCard(); }});
+    factoryVector.append({"ElaImageCard", QSize(400, 200), []() { return new ElaImageCard(); }});
+    factoryVector.append({"ElaInteractiveCard", QSize(), []() { return new ElaInteractiveCard(); }});
+    factoryVector.append({"ElaPopularCard", QSize(), []() { return new ElaPopularCard(); }});
+    factoryVector.append({"ElaPromotionCard", QSize(400, 200), []() { return new ElaPromotionCard(); }});
+    factoryVector.append({"ElaReminderCard", QSize(), []() { return new ElaReminderCard(); }});
+    factoryVector.append({"ElaNavigationBar", QSize(300, 600), []() { return new ElaNavigationBar(); }});
+    factoryVector.append({"ElaGraphicsView", QSize(400, 300), []() { return new ElaGraphicsView(); }});
+    factoryVector.append({"ElaColorDialog", QSize(), []() { return new ElaColorDialog(); }});
+    factoryVector.append({"ElaWidget", QSize(500, 400), []() { return new ElaWidget(); }});
+    factoryVector.append({"ElaWindow", QSize(1200, 740), []() { return new ElaWindow(); }});
+    return factoryVector;
+}
+
+int main(int argc, char* argv[])
+{
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+    {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication a(argc, argv);
+    eApp->init();
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("ElaWidgetTools headless paint benchmark");
+    parser.addHelpOption();
+    QCommandLineOption iterationOption("iterations", "Renders per widget and theme.", "count", "100");
+    QCommandLineOption warmupOption("warmup", "Untimed renders before measuring.", "count", "5");
+    QCommandLineOption filterOption("filter", "Only run widgets matching the regular expression.", "regex");
+    QCommandLineOption outputOption({"o", "output"}, "Write JSON report to file instead of stdout.", "path");
+    parser.addOptions({iterationOption, warmupOption, filterOption, outputOption});
+    parser.process(a);
+
+    int iterations = qMax(1, parser.value(iterationOption).toInt());
+    int warmupCount = qMax(0, parser.value(warmupOption).toInt());
+    QRegularExpression filterRegex(parser.value(filterOption));
+
+    ElaBenchmarkReporter reporter("ElaWidgetPaintBenchmark");
+    reporter.setParameter("iterations", iterations);
+    reporter.setParameter("warmup", warmupCount);
+    reporter.setParameter("filter", parser.value(filterOption));
+
+    for (const auto& factory : createWidgetFactoryVector())
+    {
+        if (!filterRegex.pattern().isEmpty() && !filterRegex.match(factory.widgetName).hasMatch())
+        {
+            continue;
+        }
+        QWidget* widget = factory.createWidget();
+        widget->setAttribute(Qt::WA_DontShowOnScreen);
+        widget->resize(factory.widgetSize.isValid() ? factory.widgetSize : widget->sizeHint().expandedTo(QSize(1, 1)));
+        widget->show();
+        QApplication::processEvents();
+        QImage renderImage(widget->size() * widget->devicePixelRatioF(), QImage::Format_ARGB32_Premultiplied);
+        renderImage.setDevicePixelRatio(widget->devicePixelRatioF());
+        for (auto themeMode : {ElaThemeType::Light, ElaThemeType::Dark})
+        {
+            eTheme->setThemeMode(themeMode);
+            QApplication::processEvents();
+            for (int i = 0; i < warmupCount; i++)
+            {
+                widget->render(&renderImage);
+            }
+            QVector<double> sampleVector;
+            sampleVector.reserve(iterations);
+            quint64 startAllocationCount = allocationCount.load(std::memory_order_relaxed);
+            quint64 startAllocationBytes = allocationBytes.load(std::memory_order_relaxed);
+            for (int i = 0; i < iterations; i++)
+            {
+                QElapsedTimer timer;
+                timer.start();
+                widget->render(&renderImage);
+                sampleVector.append(ElaBenchmarkReporter::elapsedMsec(timer));
+            }
+            double renderAllocationCount = static_cast<double>(allocationCount.load(std::memory_order_relaxed) - startAllocationCount) / iterations;
+            double renderAllocationBytes = static_cast<double>(allocationBytes.load(std::memory_order_relaxed) - startAllocationBytes) / iterations;
+            QString themeName = themeMode == ElaThemeType::Light ? "light" : "dark";
+            reporter.addResult(QString("%1_%2").arg(factory.widgetName, themeName), sampleVector, "ms",
+                               {{"widget", factory.widgetName},
+                                {"theme", themeName},
+                                {"width", widget->width()},
+                                {"height", widget->height()},
+                                {"allocationsPerRender", renderAllocationCount},
+                                {"allocatedBytesPerRender", renderAllocationBytes}});
+        }
+        delete widget;
+        QApplication::processEvents();
+    }
+    eTheme->setThemeMode(ElaThemeType::Light);
+    return reporter.write(parser.value(outputOption)) ? 0 : 1;
+}
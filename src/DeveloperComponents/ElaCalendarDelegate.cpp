@@ -183,5 +183,26 @@ void ElaCalendarDelegate::_drawDays(QPainter* painter, const QStyleOptionViewIte
             painter->setFont(font);
             painter->drawText(itemRect, Qt::AlignTop | Qt::AlignHCenter, desText);
         }
+        if (data.annotationCount > 0 || !data.annotationText.isEmpty())
+        {
+            _drawAnnotation(painter, option.rect, data);
+        }
     }
 }
+
+void ElaCalendarDelegate::_drawAnnotation(QPainter* painter, const QRectF& itemRect, const ElaCalendarData& data) const
+{
+    // 右上角角标
+    QString annotationText = data.annotationText.isEmpty() ? (data.annotationCount > 99 ? QStringLiteral("99+") : QString::number(data.annotationCount)) : data.annotationText;
+    QFont font = painter->font();
+    font.setPixelSize(8);
+    painter->setFont(font);
+    qreal badgeHeight = 12;
+    qreal badgeWidth = qMax(badgeHeight, painter->fontMetrics().horizontalAdvance(annotationText) + 6.0);
+    QRectF badgeRect(itemRect.right() - badgeWidth, itemRect.top() + 1, badgeWidth, badgeHeight);
+    painter->setPen(Qt::NoPen);
+    painter->setBrush(ElaThemeColor(_themeMode, StatusDanger));
+    painter->drawRoundedRect(badgeRect, badgeHeight / 2, badgeHeight / 2);
+    painter->setPen(Qt::white);
+    painter->drawText(badgeRect, Qt::AlignCenter, annotationText);
+}
@@ -27,6 +27,7 @@ private:
     QDate _nowDate;
     void _drawYearOrMonth(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const;
     void _drawDays(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const;
+    void _drawAnnotation(QPainter* painter, const QRectF& itemRect, const ElaCalendarData& data) const;
 };
 
 #endif // ELACALENDARDELEGATE_H
@@ -5,6 +5,10 @@ ElaCalendarModel::ElaCalendarModel(QObject* parent)
 {
     _pMinimumDate.setDate(1924, 1, 1);
     _pMaximumDate.setDate(2124, 12, 31);
+    for (int month = 1; month <= 12; month++)
+    {
+        _monthTextList.append(QString("%1月").arg(month));
+    }
     _initRowCount();
 }
 
@@ -14,8 +18,29 @@ ElaCalendarModel::~ElaCalendarModel()
 
 void ElaCalendarModel::setMinimumDate(QDate minimudate)
 {
+    beginResetModel();
+    QDate lastMinimumDate = _pMinimumDate;
     _pMinimumDate = minimudate;
     _initRowCount();
+    // 标注以距最小日期的天数存储 范围变化后需整体平移
+    QVector<qint32> lastAnnotationIndexVector;
+    lastAnnotationIndexVector.swap(_annotationIndexVector);
+    QVector<ElaCalendarAnnotation> lastAnnotationVector;
+    lastAnnotationVector.swap(_annotationVector);
+    _freeAnnotationIndexVector.clear();
+    for (int i = 0; i < lastAnnotationIndexVector.count(); i++)
+    {
+        if (lastAnnotationIndexVector[i] > 0)
+        {
+            const ElaCalendarAnnotation& annotation = lastAnnotationVector[lastAnnotationIndexVector[i] - 1];
+            int dayIndex = _getDayIndex(lastMinimumDate.addDays(i));
+            if (dayIndex >= 0)
+            {
+                _insertAnnotation(dayIndex, annotation.count, annotation.annotationText);
+            }
+        }
+    }
+    endResetModel();
 }
 
 QDate ElaCalendarModel::getMinimumDate() const
@@ -25,8 +50,23 @@ QDate ElaCalendarModel::getMinimumDate() const
 
 void ElaCalendarModel::setMaximumDate(QDate maximumDate)
 {
+    beginResetModel();
     _pMaximumDate = maximumDate;
     _initRowCount();
+    int dayCount = _pMinimumDate.daysTo(_pMaximumDate) + 1;
+    for (int i = dayCount; i < _annotationIndexVector.count(); i++)
+    {
+        if (_annotationIndexVector[i] > 0)
+        {
+            _annotationVector[_annotationIndexVector[i] - 1] = ElaCalendarAnnotation();
+            _freeAnnotationIndexVector.append(_annotationIndexVector[i] - 1);
+        }
+    }
+    if (!_annotationIndexVector.isEmpty())
+    {
+        _annotationIndexVector.resize(dayCount);
+    }
+    endResetModel();
 }
 
 QDate ElaCalendarModel::getMaximumDate() const
@@ -38,6 +78,7 @@ void ElaCalendarModel::setDisplayMode(ElaCalendarType displayMode)
 {
     beginResetModel();
     _displayMode = displayMode;
+    _clearDataCache();
     endResetModel();
     Q_EMIT displayModeChanged();
 }
@@ -80,45 +121,86 @@ QVariant ElaCalendarModel::data(const QModelIndex& index, int role) const
 {
     if (role == Qt::UserRole)
     {
-        switch (_displayMode)
+        int row = index.row();
+        if (row < 0 || row >= rowCount() || (_displayMode == DayMode && row < _offset))
         {
-        case YearMode:
-        {
-            return QVariant::fromValue<ElaCalendarData>(ElaCalendarData(_pMinimumDate.year() + index.row(), 1, 1));
+            return QVariant();
         }
-        case MonthMode:
+        if (row < _cacheStartRow || row >= _cacheStartRow + _cacheDataVector.count())
         {
-            int year = _pMinimumDate.year() + index.row() / 12;
-            int month = index.row() % 12 + 1;
-            if (month == 1)
-            {
-                return QVariant::fromValue<ElaCalendarData>(ElaCalendarData(year, month, 1, QString::number(year)));
-            }
-            else
-            {
-                return QVariant::fromValue<ElaCalendarData>(ElaCalendarData(_pMinimumDate.year() + index.row() / 12, month, 1));
-            }
-        }
-        case DayMode:
-        {
-            if (index.row() >= _offset)
-            {
-                QDate date = getDateFromIndex(index);
-                if (date.day() == 1)
-                {
-                    return QVariant::fromValue<ElaCalendarData>(ElaCalendarData(date.year(), date.month(), date.day(), QString("%1月").arg(date.month())));
-                }
-                else
-                {
-                    return QVariant::fromValue<ElaCalendarData>(ElaCalendarData(date.year(), date.month(), date.day()));
-                }
-            }
-        }
+            _fillDataCache(row);
         }
+        return QVariant::fromValue<ElaCalendarData>(_cacheDataVector[row - _cacheStartRow]);
     }
     return QVariant();
 }
 
+void ElaCalendarModel::setDateAnnotation(QDate date, int count, const QString& annotationText)
+{
+    int dayIndex = _getDayIndex(date);
+    if (dayIndex < 0)
+    {
+        return;
+    }
+    if (count <= 0 && annotationText.isEmpty())
+    {
+        removeDateAnnotation(date);
+        return;
+    }
+    _insertAnnotation(dayIndex, count, annotationText);
+    _updateCacheData(dayIndex + _offset);
+}
+
+void ElaCalendarModel::removeDateAnnotation(QDate date)
+{
+    int dayIndex = _getDayIndex(date);
+    if (dayIndex < 0 || dayIndex >= _annotationIndexVector.count() || _annotationIndexVector[dayIndex] == 0)
+    {
+        return;
+    }
+    qint32 annotationIndex = _annotationIndexVector[dayIndex] - 1;
+    _annotationVector[annotationIndex] = ElaCalendarAnnotation();
+    _freeAnnotationIndexVector.append(annotationIndex);
+    _annotationIndexVector[dayIndex] = 0;
+    _updateCacheData(dayIndex + _offset);
+}
+
+void ElaCalendarModel::clearDateAnnotation()
+{
+    if (_annotationIndexVector.isEmpty())
+    {
+        return;
+    }
+    _annotationIndexVector.clear();
+    _annotationVector.clear();
+    _freeAnnotationIndexVector.clear();
+    _clearDataCache();
+    if (_displayMode == DayMode)
+    {
+        Q_EMIT dataChanged(index(0), index(rowCount() - 1));
+    }
+}
+
+int ElaCalendarModel::getDateAnnotationCount(QDate date) const
+{
+    int dayIndex = _getDayIndex(date);
+    if (dayIndex < 0 || dayIndex >= _annotationIndexVector.count() || _annotationIndexVector[dayIndex] == 0)
+    {
+        return 0;
+    }
+    return _annotationVector[_annotationIndexVector[dayIndex] - 1].count;
+}
+
+QString ElaCalendarModel::getDateAnnotationText(QDate date) const
+{
+    int dayIndex = _getDayIndex(date);
+    if (dayIndex < 0 || dayIndex >= _annotationIndexVector.count() || _annotationIndexVector[dayIndex] == 0)
+    {
+        return QString();
+    }
+    return _annotationVector[_annotationIndexVector[dayIndex] - 1].annotationText;
+}
+
 int ElaCalendarModel::rowCount(const QModelIndex& parent) const
 {
     switch (_displayMode)
@@ -144,6 +226,116 @@ void ElaCalendarModel::_initRowCount()
     _dayRowCount = _pMinimumDate.daysTo(_pMaximumDate);
     _offset = _pMinimumDate.dayOfWeek();
     _dayRowCount += _offset + 1;
+    _clearDataCache();
+}
+
+void ElaCalendarModel::_clearDataCache()
+{
+    _cacheStartRow = 0;
+    _cacheDataVector.clear();
+}
+
+void ElaCalendarModel::_fillDataCache(int row) const
+{
+    // 以请求行为中心重建窗口 滚动时连续的请求均可命中
+    int rowCount = this->rowCount();
+    _cacheStartRow = qMax(0, row - _cacheWindowSize / 2);
+    int endRow = qMin(rowCount, _cacheStartRow + _cacheWindowSize);
+    _cacheDataVector.resize(endRow - _cacheStartRow);
+    switch (_displayMode)
+    {
+    case YearMode:
+    {
+        for (int i = _cacheStartRow; i < endRow; i++)
+        {
+            _cacheDataVector[i - _cacheStartRow] = ElaCalendarData(_pMinimumDate.year() + i, 1, 1);
+        }
+        break;
+    }
+    case MonthMode:
+    {
+        for (int i = _cacheStartRow; i < endRow; i++)
+        {
+            int year = _pMinimumDate.year() + i / 12;
+            int month = i % 12 + 1;
+            _cacheDataVector[i - _cacheStartRow] = ElaCalendarData(year, month, 1, month == 1 ? QString::number(year) : QString());
+        }
+        break;
+    }
+    case DayMode:
+    {
+        int startRow = qMax(_cacheStartRow, _offset);
+        QDate date = _pMinimumDate.addDays(startRow - _offset);
+        for (int i = startRow; i < endRow; i++, date = date.addDays(1))
+        {
+            ElaCalendarData& data = _cacheDataVector[i - _cacheStartRow];
+            int year = 0;
+            int month = 0;
+            int day = 0;
+            date.getDate(&year, &month, &day);
+            data = ElaCalendarData(year, month, day, day == 1 ? _monthTextList[month - 1] : QString());
+            int dayIndex = i - _offset;
+            if (dayIndex < _annotationIndexVector.count() && _annotationIndexVector[dayIndex] > 0)
+            {
+                const ElaCalendarAnnotation& annotation = _annotationVector[_annotationIndexVector[dayIndex] - 1];
+                data.annotationCount = annotation.count;
+                data.annotationText = annotation.annotationText;
+            }
+        }
+        break;
+    }
+    }
+}
+
+void ElaCalendarModel::_insertAnnotation(int dayIndex, int count, const QString& annotationText)
+{
+    if (_annotationIndexVector.isEmpty())
+    {
+        _annotationIndexVector.resize(_pMinimumDate.daysTo(_pMaximumDate) + 1);
+    }
+    qint32& annotationIndex = _annotationIndexVector[dayIndex];
+    if (annotationIndex == 0)
+    {
+        if (_freeAnnotationIndexVector.isEmpty())
+        {
+            _annotationVector.append(ElaCalendarAnnotation());
+            annotationIndex = _annotationVector.count();
+        }
+        else
+        {
+            annotationIndex = _freeAnnotationIndexVector.takeLast() + 1;
+        }
+    }
+    ElaCalendarAnnotation& annotation = _annotationVector[annotationIndex - 1];
+    annotation.count = count;
+    annotation.annotationText = annotationText;
+}
+
+void ElaCalendarModel::_updateCacheData(int row)
+{
+    if (_displayMode != DayMode)
+    {
+        return;
+    }
+    if (row >= _cacheStartRow && row < _cacheStartRow + _cacheDataVector.count())
+    {
+        ElaCalendarData& data = _cacheDataVector[row - _cacheStartRow];
+        int dayIndex = row - _offset;
+        bool isAnnotated = dayIndex < _annotationIndexVector.count() && _annotationIndexVector[dayIndex] > 0;
+        data.annotationCount = isAnnotated ? _annotationVector[_annotationIndexVector[dayIndex] - 1].count : 0;
+        data.annotationText = isAnnotated ? _annotationVector[_annotationIndexVector[dayIndex] - 1].annotationText : QString();
+    }
+    QModelIndex modelIndex = index(row);
+    Q_EMIT dataChanged(modelIndex, modelIndex);
+}
+
+int ElaCalendarModel::_getDayIndex(QDate date) const
+{
+    if (!date.isValid() || date < _pMinimumDate || date > _pMaximumDate)
+    {
+        return -1;
+    }
+    return static_cast<int>(_pMinimumDate.daysTo(date));
 }
 
 int ElaCalendarModel::_getCurrentDay(int row) const
@@ -4,6 +4,8 @@
 #include <QAbstractListModel>
 #include <QDate>
 #include <QMetaType>
+#include <QStringList>
+#include <QVector>
 
 #include "stdafx.h"
 enum ElaCalendarType
@@ -13,24 +15,18 @@ enum ElaCalendarType
     DayMode = 0x0003,
 };
 
-struct ElaCalendarData : public QObjectData
+struct ElaCalendarData
 {
 public:
     ElaCalendarData(){};
-    ~ElaCalendarData(){};
     ElaCalendarData(int year, int month, int day, QString desText = "")
         : year(year), month(month), day(day), desText(desText){};
-    ElaCalendarData(const ElaCalendarData& other)
-    {
-        year = other.year;
-        month = other.month;
-        day = other.day;
-        desText = other.desText;
-    }
     int year = 1924;
     int month = 1;
     int day = 1;
     QString desText{""};
+    int annotationCount{0};
+    QString annotationText;
 };
 Q_DECLARE_METATYPE(ElaCalendarData);
 
@@ -50,6 +46,13 @@ public:
     QDate getDateFromIndex(const QModelIndex& index) const;
     virtual QVariant data(const QModelIndex& index, int role) const override;
 
+    // 日期标注 超出日期范围时忽略
+    void setDateAnnotation(QDate date, int count, const QString& annotationText);
+    void removeDateAnnotation(QDate date);
+    void clearDateAnnotation();
+    int getDateAnnotationCount(QDate date) const;
+    QString getDateAnnotationText(QDate date) const;
+
 Q_SIGNALS:
     Q_SIGNAL void currentYearMonthChanged(QString date);
     Q_SIGNAL void displayModeChanged();
@@ -58,12 +61,31 @@ protected:
     virtual int rowCount(const QModelIndex& parent = QModelIndex()) const override;
 
 private:
+    struct ElaCalendarAnnotation
+    {
+        int count{0};
+        QString annotationText;
+    };
     int _offset{0};
     QDate _pMinimumDate;
     QDate _pMaximumDate;
     ElaCalendarType _displayMode{ElaCalendarType::DayMode};
     int _dayRowCount{0};
+    QStringList _monthTextList;
+    // 以距最小日期的天数为下标 0表示无标注 否则为_annotationVector下标+1
+    QVector<qint32> _annotationIndexVector;
+    QVector<ElaCalendarAnnotation> _annotationVector;
+    QVector<qint32> _freeAnnotationIndexVector;
+    // 当前可见区域附近的单元格数据缓存
+    int _cacheWindowSize{256};
+    mutable int _cacheStartRow{0};
+    mutable QVector<ElaCalendarData> _cacheDataVector;
     void _initRowCount();
+    void _clearDataCache();
+    void _fillDataCache(int row) const;
+    void _insertAnnotation(int dayIndex, int count, const QString& annotationText);
+    void _updateCacheData(int row);
+    int _getDayIndex(QDate date) const;
     int _getCurrentDay(int row) const;
 };
 
@@ -0,0 +1,109 @@
+#include "ElaCardGridDelegate.h"
+
+#include <QPainter>
+#include <QPixmapCache>
+
+#include "ElaCardPainter.h"
+#include "ElaTheme.h"
+ElaCardGridDelegate::ElaCardGridDelegate(QObject* parent)
+    : QStyledItemDelegate{parent}
+{
+    _pCardMode = ElaCardGridType::PopularCard;
+    _pItemSize = QSize(320, 120);
+    _themeMode = eTheme->getThemeMode();
+    _cardImageCache.setMaxCost(32 * 1024);
+    connect(eTheme, &ElaTheme::themeModeChanged, this, [=](ElaThemeType::ThemeMode themeMode) {
+        _themeMode = themeMode;
+    });
+}
+
+ElaCardGridDelegate::~ElaCardGridDelegate()
+{
+}
+
+void ElaCardGridDelegate::paint(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const
+{
+    // 与卡片控件共用绘制 数据全部取自模型 不持有逐项状态
+    bool isHover = option.state.testFlag(QStyle::State_MouseOver);
+    ElaCardPaintData paintData;
+    paintData.title = index.data(Qt::DisplayRole).toString();
+    QVariant decorationData = index.data(Qt::DecorationRole);
+    painter->save();
+    painter->setFont(option.font);
+    switch (_pCardMode)
+    {
+    case ElaCardGridType::PopularCard:
+    {
+        paintData.borderRadius = 8;
+        paintData.cardPixmap = _getCardPixmap(decorationData);
+        paintData.subTitle = index.data(ElaCardGridType::SubTitleRole).toString();
+        paintData.interactiveTips = index.data(ElaCardGridType::InteractiveTipsRole).toString();
+        paintData.hoverYOffset = isHover ? 6 : 0;
+        paintData.hoverOpacity = isHover ? 1 : 0;
+        ElaCardPainter::drawPopularCard(painter, option.rect, paintData, _themeMode, isHover);
+        break;
+    }
+    case ElaCardGridType::InteractiveCard:
+    {
+        paintData.cardPixmap = _getCardPixmap(decorationData);
+        paintData.subTitle = index.data(ElaCardGridType::SubTitleRole).toString();
+        ElaCardPainter::drawInteractiveCard(painter, option.rect, paintData, _themeMode, isHover);
+        break;
+    }
+    case ElaCardGridType::ImageCard:
+    {
+        paintData.cardImage = _getCardImage(decorationData);
+        ElaCardPainter::drawImageCard(painter, option.rect, paintData);
+        break;
+    }
+    }
+    // 选中框
+    if (option.state.testFlag(QStyle::State_Selected))
+    {
+        painter->setRenderHint(QPainter::Antialiasing);
+        painter->setPen(QPen(ElaThemeColor(_themeMode, PrimaryNormal), 2));
+        painter->setBrush(Qt::NoBrush);
+        painter->drawRoundedRect(QRectF(option.rect).adjusted(1, 1, -1, -1), paintData.borderRadius, paintData.borderRadius);
+    }
+    painter->restore();
+}
+
+QSize ElaCardGridDelegate::sizeHint(const QStyleOptionViewItem& option, const QModelIndex& index) const
+{
+    return _pItemSize;
+}
+
+QPixmap ElaCardGridDelegate::_getCardPixmap(const QVariant& decorationData) const
+{
+    if (decorationData.userType() != QMetaType::QImage)
+    {
+        return decorationData.value<QPixmap>();
+    }
+    QImage cardImage = decorationData.value<QImage>();
+    QString pixmapKey = QString("ElaCardGridDelegate:%1").arg(cardImage.cacheKey());
+    QPixmap cardPixmap;
+    if (!QPixmapCache::find(pixmapKey, &cardPixmap))
+    {
+        cardPixmap = QPixmap::fromImage(cardImage);
+        QPixmapCache::insert(pixmapKey, cardPixmap);
+    }
+    return cardPixmap;
+}
+
+QImage ElaCardGridDelegate::_getCardImage(const QVariant& decorationData) const
+{
+    if (decorationData.userType() != QMetaType::QPixmap)
+    {
+        return decorationData.value<QImage>();
+    }
+    QPixmap cardPixmap = decorationData.value<QPixmap>();
+    QImage* cacheImage = _cardImageCache.object(cardPixmap.cacheKey());
+    if (cacheImage)
+    {
+        return *cacheImage;
+    }
+    QImage cardImage = cardPixmap.toImage();
+    // 插入后可能立即被淘汰 返回本地副本
+    _cardImageCache.insert(cardPixmap.cacheKey(), new QImage(cardImage), qMax(1, static_cast<int>(cardImage.sizeInBytes() / 1024)));
+    return cardImage;
+}
@@ -0,0 +1,30 @@
+#ifndef ELACARDGRIDDELEGATE_H
+#define ELACARDGRIDDELEGATE_H
+
+#include <QCache>
+#include <QImage>
+#include <QPixmap>
+#include <QStyledItemDelegate>
+
+#include "Def.h"
+class ElaCardGridDelegate : public QStyledItemDelegate
+{
+    Q_OBJECT
+    Q_PRIVATE_CREATE(ElaCardGridType::CardMode, CardMode)
+    Q_PRIVATE_CREATE(QSize, ItemSize)
+public:
+    explicit ElaCardGridDelegate(QObject* parent = nullptr);
+    ~ElaCardGridDelegate();
+
+    void paint(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const override;
+    QSize sizeHint(const QStyleOptionViewItem& option, const QModelIndex& index) const override;
+
+private:
+    ElaThemeType::ThemeMode _themeMode;
+    // 模型数据与绘制所需类型不一致时 按源数据cacheKey缓存转换结果 避免每次绘制都转换
+    mutable QCache<qint64, QImage> _cardImageCache;
+    QPixmap _getCardPixmap(const QVariant& decorationData) const;
+    QImage _getCardImage(const QVariant& decorationData) const;
+};
+
+#endif // ELACARDGRIDDELEGATE_H
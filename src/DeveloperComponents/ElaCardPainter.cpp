@@ -0,0 +1,172 @@
+#include "ElaCardPainter.h"
+
+#include <QPainterPath>
+
+#include "ElaTheme.h"
+void ElaCardPainter::drawInteractiveCard(QPainter* painter, const QRect& rect, const ElaCardPaintData& paintData, ElaThemeType::ThemeMode themeMode, bool isHover)
+{
+    int width = rect.width();
+    int height = rect.height();
+    painter->save();
+    painter->translate(rect.topLeft());
+    painter->setRenderHints(QPainter::SmoothPixmapTransform | QPainter::Antialiasing | QPainter::TextAntialiasing);
+    painter->setPen(Qt::NoPen);
+    painter->setBrush(isHover ? ElaThemeColor(themeMode, BasicHoverAlpha) : Qt::transparent);
+    painter->drawRoundedRect(QRect(0, 0, width, height), paintData.borderRadius, paintData.borderRadius);
+    // 图片绘制
+    const QSize& cardPixmapSize = paintData.cardPixmapSize;
+    if (!paintData.cardPixmap.isNull())
+    {
+        painter->save();
+        QPainterPath path;
+        if (paintData.cardPixMode == ElaCardPixType::PixMode::Ellipse)
+        {
+            path.addEllipse(QPointF(cardPixmapSize.width() / 2 + 10, height / 2), cardPixmapSize.width() / 2, cardPixmapSize.height() / 2);
+            painter->setClipPath(path);
+            painter->drawPixmap(QRect(10, (height - cardPixmapSize.height()) / 2, cardPixmapSize.width(), cardPixmapSize.height()), paintData.cardPixmap);
+        }
+        else if (paintData.cardPixMode == ElaCardPixType::PixMode::Default)
+        {
+            painter->drawPixmap(10, (height - cardPixmapSize.height()) / 2, cardPixmapSize.width(), cardPixmapSize.height(), paintData.cardPixmap);
+        }
+        else if (paintData.cardPixMode == ElaCardPixType::PixMode::RoundedRect)
+        {
+            path.addRoundedRect(QRectF(10, (height - cardPixmapSize.height()) / 2, cardPixmapSize.width(), cardPixmapSize.height()), paintData.cardPixmapBorderRadius, paintData.cardPixmapBorderRadius);
+            painter->setClipPath(path);
+            painter->drawPixmap(10, (height - cardPixmapSize.height()) / 2, cardPixmapSize.width(), cardPixmapSize.height(), paintData.cardPixmap);
+        }
+        painter->restore();
+    }
+    // 文字绘制
+    painter->setPen(ElaThemeColor(themeMode, BasicText));
+    QFont font = painter->font();
+    font.setWeight(QFont::Bold);
+    font.setPixelSize(paintData.titlePixelSize);
+    painter->setFont(font);
+    int textStartX = cardPixmapSize.width() + 26;
+    int textWidth = width - textStartX;
+    painter->drawText(QRect(textStartX, 0, textWidth, height / 2 - paintData.titleSpacing), Qt::TextWordWrap | Qt::AlignBottom | Qt::AlignLeft, paintData.title);
+    font.setWeight(QFont::Normal);
+    font.setPixelSize(paintData.subTitlePixelSize);
+    painter->setFont(font);
+    painter->drawText(QRect(textStartX, height / 2 + paintData.titleSpacing, textWidth, height / 2 - paintData.titleSpacing), Qt::TextWordWrap | Qt::AlignTop | Qt::AlignLeft, paintData.subTitle);
+    painter->restore();
+}
+
+void ElaCardPainter::drawImageCard(QPainter* painter, const QRect& rect, const ElaCardPaintData& paintData)
+{
+    const QImage& cardImage = paintData.cardImage;
+    painter->save();
+    painter->setPen(Qt::NoPen);
+    painter->setRenderHints(QPainter::SmoothPixmapTransform | QPainter::Antialiasing);
+    QPainterPath path;
+    path.addRoundedRect(rect, paintData.borderRadius, paintData.borderRadius);
+    painter->setClipPath(path);
+    // 图片绘制
+    if (paintData.isPreserveAspectCrop)
+    {
+        qreal itemAspectRatio = (qreal)rect.width() / rect.height();
+        if (itemAspectRatio < paintData.maximumAspectRatio)
+        {
+            itemAspectRatio = paintData.maximumAspectRatio;
+            qreal cropHeight = cardImage.width() / itemAspectRatio;
+            painter->drawImage(QRect(rect.x(), rect.y(), rect.height() * paintData.maximumAspectRatio, rect.height()), cardImage, QRectF(0, 0, cardImage.width(), cropHeight));
+        }
+        else
+        {
+            qreal cropHeight = cardImage.width() / itemAspectRatio;
+            painter->drawImage(rect, cardImage, QRectF(0, 0, cardImage.width(), cropHeight));
+        }
+    }
+    else
+    {
+        painter->drawImage(rect, cardImage);
+    }
+    painter->restore();
+}
+
+QRectF ElaCardPainter::drawPopularCard(QPainter* painter, const QRect& rect, const ElaCardPaintData& paintData, ElaThemeType::ThemeMode themeMode, bool isHover)
+{
+    int width = rect.width();
+    int height = rect.height();
+    int shadowBorderWidth = paintData.shadowBorderWidth;
+    painter->save();
+    painter->translate(rect.topLeft());
+    painter->setRenderHints(QPainter::SmoothPixmapTransform | QPainter::Antialiasing | QPainter::TextAntialiasing);
+    if (isHover)
+    {
+        // 阴影绘制
+        painter->setOpacity(paintData.hoverOpacity);
+        QRect shadowRect(0, 0, width, height);
+        shadowRect.adjust(0, 0, 0, -paintData.hoverYOffset);
+        eTheme->drawEffectShadow(painter, shadowRect, shadowBorderWidth, paintData.borderRadius);
+    }
+    QRectF foregroundRect(shadowBorderWidth, shadowBorderWidth - paintData.hoverYOffset + 1, width - 2 * shadowBorderWidth, height - 2 * shadowBorderWidth);
+    //背景绘制
+    painter->setOpacity(1);
+    painter->setPen(isHover ? ElaThemeColor(themeMode, PopupBorderHover) : ElaThemeColor(themeMode, BasicBorder));
+    painter->setBrush(ElaThemeColor(themeMode, BasicBaseAlpha));
+    painter->drawRoundedRect(foregroundRect, paintData.borderRadius, paintData.borderRadius);
+    //图片绘制
+    painter->save();
+    QRectF pixRect(foregroundRect.x() + foregroundRect.height() * 0.15, foregroundRect.y() + foregroundRect.height() * 0.15, foregroundRect.height() * 0.7, foregroundRect.height() * 0.7);
+    QPainterPath pixPath;
+    pixPath.addRoundedRect(pixRect, 4, 4);
+    painter->setClipPath(pixPath);
+    painter->drawPixmap(pixRect, paintData.cardPixmap, paintData.cardPixmap.rect());
+    painter->restore();
+
+    //文字绘制
+    qreal textWidth = paintData.textWidthOffset + foregroundRect.width() - pixRect.width() - paintData.textHSpacing * 2 - foregroundRect.height() * 0.15;
+    // Title
+    painter->setPen(ElaThemeColor(themeMode, BasicText));
+    QFont font = painter->font();
+    font.setWeight(QFont::Bold);
+    font.setPixelSize(15);
+    painter->setFont(font);
+    int titleHeight = painter->fontMetrics().height();
+    QRectF titleRect(pixRect.right() + paintData.textHSpacing, pixRect.y(), textWidth, titleHeight);
+    QString titleText = painter->fontMetrics().elidedText(paintData.title, Qt::ElideRight, titleRect.width());
+    painter->drawText(titleRect, Qt::AlignLeft | Qt::AlignTop | Qt::TextSingleLine, titleText);
+
+    // SubTitle
+    font.setWeight(QFont::DemiBold);
+    font.setPixelSize(13);
+    painter->setFont(font);
+    int subTitleHeight = painter->fontMetrics().height();
+    QRectF subTitleRect(pixRect.right() + paintData.textHSpacing, titleRect.bottom() + paintData.textVSpacing, textWidth, subTitleHeight);
+    QString subTitleText = painter->fontMetrics().elidedText(paintData.subTitle, Qt::ElideRight, subTitleRect.width());
+    painter->drawText(subTitleRect, Qt::AlignLeft | Qt::AlignTop | Qt::TextSingleLine, subTitleText);
+
+    // InteractiveTips
+    QRectF interactiveTipsBaseRect;
+    int tipWidth = painter->fontMetrics().horizontalAdvance(paintData.interactiveTips);
+    int tipHeight = painter->fontMetrics().height();
+    if (!paintData.interactiveTips.isEmpty())
+    {
+        font.setWeight(QFont::DemiBold);
+        font.setPixelSize(12);
+        painter->setFont(font);
+        //覆盖背景绘制
+        QRectF tipRect(foregroundRect.right() - paintData.textHSpacing - tipWidth, foregroundRect.bottom() - paintData.textHSpacing - tipHeight, foregroundRect.width() / 2 - paintData.textHSpacing, tipHeight);
+        painter->setPen(Qt::NoPen);
+        painter->setBrush(ElaThemeColor(themeMode, BasicBaseDeep));
+        QRectF baseRect = tipRect;
+        baseRect.setRight(tipRect.x() + tipWidth);
+        baseRect.adjust(-7, -3, 4, 3);
+        interactiveTipsBaseRect = baseRect;
+        painter->drawRoundedRect(baseRect, 6, 6);
+        //文字绘制
+        painter->setPen(ElaThemeColor(themeMode, BasicText));
+        painter->drawText(tipRect, Qt::AlignLeft | Qt::AlignVCenter | Qt::TextSingleLine, paintData.interactiveTips);
+    }
+    else
+    {
+        QRectF tipRect(foregroundRect.right() - paintData.textHSpacing - 50, foregroundRect.bottom() - paintData.textHSpacing - tipHeight, foregroundRect.width() / 2 - paintData.textHSpacing, tipHeight);
+        tipRect.setRight(tipRect.x() + tipWidth);
+        tipRect.adjust(-7, -3, 4, 3);
+        interactiveTipsBaseRect = tipRect;
+    }
+    painter->restore();
+    return interactiveTipsBaseRect.translated(rect.topLeft());
+}
@@ -0,0 +1,47 @@
+#ifndef ELACARDPAINTER_H
+#define ELACARDPAINTER_H
+
+#include <QImage>
+#include <QPainter>
+#include <QPixmap>
+
+#include "Def.h"
+// 卡片绘制参数 默认值与对应卡片控件一致
+struct ElaCardPaintData
+{
+    int borderRadius{6};
+    QPixmap cardPixmap;
+    QImage cardImage;
+    QString title;
+    QString subTitle;
+    QString interactiveTips;
+    // InteractiveCard
+    QSize cardPixmapSize{64, 64};
+    ElaCardPixType::PixMode cardPixMode{ElaCardPixType::Ellipse};
+    int cardPixmapBorderRadius{6};
+    int titlePixelSize{15};
+    int subTitlePixelSize{12};
+    int titleSpacing{2};
+    // ImageCard
+    bool isPreserveAspectCrop{true};
+    qreal maximumAspectRatio{2.2};
+    // PopularCard
+    int shadowBorderWidth{6};
+    int textHSpacing{20};
+    int textVSpacing{5};
+    qreal hoverYOffset{0};
+    qreal hoverOpacity{0};
+    qreal textWidthOffset{0}; // 标题宽度修正 悬浮按钮预留
+};
+
+// 卡片控件与ElaCardGridView代理共用的绘制函数 rect为卡片区域 文字以painter当前字体为基准
+class ElaCardPainter
+{
+public:
+    static void drawInteractiveCard(QPainter* painter, const QRect& rect, const ElaCardPaintData& paintData, ElaThemeType::ThemeMode themeMode, bool isHover);
+    static void drawImageCard(QPainter* painter, const QRect& rect, const ElaCardPaintData& paintData);
+    // 返回InteractiveTips底板区域
+    static QRectF drawPopularCard(QPainter* painter, const QRect& rect, const ElaCardPaintData& paintData, ElaThemeType::ThemeMode themeMode, bool isHover);
+};
+
+#endif // ELACARDPAINTER_H
@@ -4,6 +4,7 @@
 #include <QPropertyAnimation>
 #include <QStyleOptionSlider>
 
+#include "ElaApplication.h"
 #include "ElaTheme.h"
 ElaColorValueSliderStyle::ElaColorValueSliderStyle(QStyle* style)
 {
@@ -153,6 +154,7 @@ void ElaColorValueSliderStyle::_startRadiusAnimation(qreal startRadius, qreal en
         this->_circleRadius = value.toReal();
         widget->update(); });
     circleRadiusAnimation->setEasingCurve(QEasingCurve::InOutSine);
+    circleRadiusAnimation->setDuration(eApp->getAnimationDuration(250));
     circleRadiusAnimation->setStartValue(startRadius);
     circleRadiusAnimation->setEndValue(endRadius);
     circleRadiusAnimation->start(QAbstractAnimation::DeleteWhenStopped);
@@ -4,8 +4,10 @@
 #include <QPainterPath>
 #include <QPropertyAnimation>
 
+#include "ElaApplication.h"
 #include "ElaBaseListView.h"
 #include "ElaFooterModel.h"
+#include "ElaIconGlyphPainter.h"
 #include "ElaNavigationNode.h"
 #include "ElaTheme.h"
 ElaFooterDelegate::ElaFooterDelegate(QObject* parent)
@@ -37,6 +39,7 @@ ElaFooterDelegate::ElaFooterDelegate(QObject* parent)
     connect(_lastSelectMarkTopAnimation, &QPropertyAnimation::finished, this, [=]() {
         _isSelectMarkDisplay = true;
         _lastSelectedNode = nullptr;
+        _selectMarkBottomAnimation->setDuration(eApp->getAnimationDuration(300));
         _selectMarkBottomAnimation->setStartValue(0);
         _selectMarkBottomAnimation->setEndValue(10);
         _selectMarkBottomAnimation->start(); });
@@ -58,6 +61,7 @@ ElaFooterDelegate::ElaFooterDelegate(QObject* parent)
     connect(_lastSelectMarkBottomAnimation, &QPropertyAnimation::finished, this, [=]() {
         _isSelectMarkDisplay = true;
         _lastSelectedNode = nullptr;
+        _selectMarkTopAnimation->setDuration(eApp->getAnimationDuration(300));
         _selectMarkTopAnimation->setStartValue(0);
         _selectMarkTopAnimation->setEndValue(10);
         _selectMarkTopAnimation->start(); });
@@ -80,21 +84,25 @@ void ElaFooterDelegate::navigationNodeStateChange(QVariantMap data)
         _selectMarkBottom = 10;
         if (direction)
         {
-            _lastSelectMarkTopAnimation->setStartValue(10);
-            _lastSelectMarkTopAnimation->setEndValue(0);
-            _lastSelectMarkTopAnimation->start();
             _lastSelectMarkBottomAnimation->stop();
             _selectMarkTopAnimation->stop();
+            // 时长为0时start()会同步触发finished 需先复位显示状态
             _isSelectMarkDisplay = false;
+            _lastSelectMarkTopAnimation->setDuration(eApp->getAnimationDuration(300));
+            _lastSelectMarkTopAnimation->setStartValue(10);
+            _lastSelectMarkTopAnimation->setEndValue(0);
+            _lastSelectMarkTopAnimation->start();
         }
         else
         {
-            _lastSelectMarkBottomAnimation->setStartValue(10);
-            _lastSelectMarkBottomAnimation->setEndValue(0);
-            _lastSelectMarkBottomAnimation->start();
             _lastSelectMarkTopAnimation->stop();
             _selectMarkBottomAnimation->stop();
+            // 时长为0时start()会同步触发finished 需先复位显示状态
             _isSelectMarkDisplay = false;
+            _lastSelectMarkBottomAnimation->setDuration(eApp->getAnimationDuration(300));
+            _lastSelectMarkBottomAnimation->setStartValue(10);
+            _lastSelectMarkBottomAnimation->setEndValue(0);
+            _lastSelectMarkBottomAnimation->start();
         }
     }
 }
@@ -171,12 +179,7 @@ void ElaFooterDelegate::paint(QPainter* painter, const QStyleOptionViewItem& opt
     painter->setPen(index == _pPressIndex ? ElaThemeColor(_themeMode, BasicTextPress) : ElaThemeColor(_themeMode, BasicText));
     if (node->getAwesome() != ElaIconType::None)
     {
-        painter->save();
-        QFont iconFont = QFont("ElaAwesome");
-        iconFont.setPixelSize(17);
-        painter->setFont(iconFont);
-        painter->drawText(QRect(itemRect.x(), itemRect.y(), _iconAreaWidth, itemRect.height()), Qt::AlignCenter, QChar((unsigned short)node->getAwesome()));
-        painter->restore();
+        ElaIconGlyphPainter::drawIcon(painter, QRect(itemRect.x(), itemRect.y(), _iconAreaWidth, itemRect.height()), Qt::AlignCenter, node->getAwesome(), 17);
     }
 
     int keyPoints = node->getKeyPoints();
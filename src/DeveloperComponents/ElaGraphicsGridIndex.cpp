@@ -0,0 +1,223 @@
+#include "ElaGraphicsGridIndex.h"
+
+#include <QSet>
+#include <QtMath>
+
+#include <algorithm>
+
+#include "ElaGraphicsItem.h"
+ElaGraphicsGridIndex::ElaGraphicsGridIndex()
+{
+}
+
+ElaGraphicsGridIndex::~ElaGraphicsGridIndex()
+{
+}
+
+void ElaGraphicsGridIndex::setCellSize(int cellSize)
+{
+    if (cellSize <= 0 || cellSize == _cellSize)
+    {
+        return;
+    }
+    _cellSize = cellSize;
+    QList<ElaGraphicsItem*> itemList = _itemCellRangeHash.keys();
+    rebuild(itemList);
+}
+
+int ElaGraphicsGridIndex::getCellSize() const
+{
+    return _cellSize;
+}
+
+void ElaGraphicsGridIndex::insertItem(ElaGraphicsItem* item)
+{
+    if (!item || _itemCellRangeHash.contains(item))
+    {
+        return;
+    }
+    QRect cellRange = _getCellRange(item->sceneBoundingRect());
+    _itemCellRangeHash.insert(item, cellRange);
+    _insertCellRange(item, cellRange);
+}
+
+void ElaGraphicsGridIndex::removeItem(ElaGraphicsItem* item)
+{
+    auto it = _itemCellRangeHash.find(item);
+    if (it == _itemCellRangeHash.end())
+    {
+        return;
+    }
+    _removeCellRange(item, it.value());
+    _itemCellRangeHash.erase(it);
+}
+
+void ElaGraphicsGridIndex::updateItem(ElaGraphicsItem* item)
+{
+    auto it = _itemCellRangeHash.find(item);
+    if (it == _itemCellRangeHash.end())
+    {
+        return;
+    }
+    QRect cellRange = _getCellRange(item->sceneBoundingRect());
+    // 拖动多数情况下不跨越网格 无需更新
+    if (cellRange == it.value())
+    {
+        return;
+    }
+    _removeCellRange(item, it.value());
+    _insertCellRange(item, cellRange);
+    it.value() = cellRange;
+}
+
+void ElaGraphicsGridIndex::rebuild(const QList<ElaGraphicsItem*>& itemList)
+{
+    clear();
+    _itemCellRangeHash.reserve(itemList.count());
+    for (auto item : itemList)
+    {
+        insertItem(item);
+    }
+}
+
+void ElaGraphicsGridIndex::clear()
+{
+    _cellHash.clear();
+    _itemCellRangeHash.clear();
+    _occupiedCellRange = QRect();
+}
+
+QList<ElaGraphicsItem*> ElaGraphicsGridIndex::getItems(const QPointF& pos) const
+{
+    QList<ElaGraphicsItem*> itemList;
+    auto it = _cellHash.constFind(_getCellKey(qFloor(pos.x() / _cellSize), qFloor(pos.y() / _cellSize)));
+    if (it == _cellHash.constEnd())
+    {
+        return itemList;
+    }
+    for (auto item : it.value())
+    {
+        if (item->contains(item->mapFromScene(pos)))
+        {
+            itemList.append(item);
+        }
+    }
+    _sortByStackingOrder(itemList);
+    return itemList;
+}
+
+QList<ElaGraphicsItem*> ElaGraphicsGridIndex::getItems(const QRectF& rect) const
+{
+    QList<ElaGraphicsItem*> itemList;
+    if (_occupiedCellRange.isNull())
+    {
+        return itemList;
+    }
+    // 先裁剪到已占用范围 避免超大矩形遍历空网格及网格坐标溢出
+    QRectF occupiedRect(qreal(_occupiedCellRange.left()) * _cellSize, qreal(_occupiedCellRange.top()) * _cellSize, qreal(_occupiedCellRange.width()) * _cellSize, qreal(_occupiedCellRange.height()) * _cellSize);
+    QRectF clampedRect = rect.intersected(occupiedRect);
+    if (clampedRect.isEmpty())
+    {
+        return itemList;
+    }
+    QRect cellRange = _getCellRange(clampedRect).intersected(_occupiedCellRange);
+    // 网格数多于图元数时直接遍历图元
+    if (qint64(cellRange.width()) * cellRange.height() > _itemCellRangeHash.count())
+    {
+        for (auto it = _itemCellRangeHash.constBegin(); it != _itemCellRangeHash.constEnd(); ++it)
+        {
+            if (it.key()->sceneBoundingRect().intersects(rect))
+            {
+                itemList.append(it.key());
+            }
+        }
+        _sortByStackingOrder(itemList);
+        return itemList;
+    }
+    QSet<ElaGraphicsItem*> visitedSet;
+    for (int x = cellRange.left(); x <= cellRange.right(); x++)
+    {
+        for (int y = cellRange.top(); y <= cellRange.bottom(); y++)
+        {
+            auto it = _cellHash.constFind(_getCellKey(x, y));
+            if (it == _cellHash.constEnd())
+            {
+                continue;
+            }
+            for (auto item : it.value())
+            {
+                if (visitedSet.contains(item))
+                {
+                    continue;
+                }
+                visitedSet.insert(item);
+                if (item->sceneBoundingRect().intersects(rect))
+                {
+                    itemList.append(item);
+                }
+            }
+        }
+    }
+    _sortByStackingOrder(itemList);
+    return itemList;
+}
+
+QRect ElaGraphicsGridIndex::_getCellRange(const QRectF& rect) const
+{
+    int left = qFloor(rect.left() / _cellSize);
+    int top = qFloor(rect.top() / _cellSize);
+    int right = qFloor(rect.right() / _cellSize);
+    int bottom = qFloor(rect.bottom() / _cellSize);
+    return QRect(QPoint(left, top), QPoint(right, bottom));
+}
+
+void ElaGraphicsGridIndex::_insertCellRange(ElaGraphicsItem* item, const QRect& cellRange)
+{
+    _occupiedCellRange = _occupiedCellRange.united(cellRange);
+    for (int x = cellRange.left(); x <= cellRange.right(); x++)
+    {
+        for (int y = cellRange.top(); y <= cellRange.bottom(); y++)
+        {
+            _cellHash[_getCellKey(x, y)].append(item);
+        }
+    }
+}
+
+void ElaGraphicsGridIndex::_removeCellRange(ElaGraphicsItem* item, const QRect& cellRange)
+{
+    for (int x = cellRange.left(); x <= cellRange.right(); x++)
+    {
+        for (int y = cellRange.top(); y <= cellRange.bottom(); y++)
+        {
+            auto it = _cellHash.find(_getCellKey(x, y));
+            if (it == _cellHash.end())
+            {
+                continue;
+            }
+            QVector<ElaGraphicsItem*>& cellItems = it.value();
+            int index = cellItems.indexOf(item);
+            if (index >= 0)
+            {
+                // 单元内顺序无关 交换删除
+                cellItems[index] = cellItems.last();
+                cellItems.removeLast();
+            }
+            if (cellItems.isEmpty())
+            {
+                _cellHash.erase(it);
+            }
+        }
+    }
+}
+
+quint64 ElaGraphicsGridIndex::_getCellKey(int x, int y)
+{
+    return (static_cast<quint64>(static_cast<quint32>(x)) << 32) | static_cast<quint32>(y);
+}
+
+void ElaGraphicsGridIndex::_sortByStackingOrder(QList<ElaGraphicsItem*>& itemList)
+{
+    std::stable_sort(itemList.begin(), itemList.end(), [](ElaGraphicsItem* item1, ElaGraphicsItem* item2) {
+        return item1->zValue() > item2->zValue();
+    });
+}
@@ -0,0 +1,42 @@
+#ifndef ELAGRAPHICSGRIDINDEX_H
+#define ELAGRAPHICSGRIDINDEX_H
+
+#include <QHash>
+#include <QList>
+#include <QRect>
+#include <QRectF>
+#include <QVector>
+
+class ElaGraphicsItem;
+// 均匀网格空间索引 图元移动时仅在所占网格范围变化时更新
+class ElaGraphicsGridIndex
+{
+public:
+    ElaGraphicsGridIndex();
+    ~ElaGraphicsGridIndex();
+    void setCellSize(int cellSize);
+    int getCellSize() const;
+
+    void insertItem(ElaGraphicsItem* item);
+    void removeItem(ElaGraphicsItem* item);
+    void updateItem(ElaGraphicsItem* item);
+    void rebuild(const QList<ElaGraphicsItem*>& itemList);
+    void clear();
+
+    // 返回按堆叠顺序降序排列的命中图元
+    QList<ElaGraphicsItem*> getItems(const QPointF& pos) const;
+    QList<ElaGraphicsItem*> getItems(const QRectF& rect) const;
+
+private:
+    int _cellSize{256};
+    QHash<quint64, QVector<ElaGraphicsItem*>> _cellHash;
+    QHash<ElaGraphicsItem*, QRect> _itemCellRangeHash;
+    QRect _occupiedCellRange; // 已占用网格的外接范围 仅随插入扩大 清空或重建时复位
+    QRect _getCellRange(const QRectF& rect) const;
+    void _insertCellRange(ElaGraphicsItem* item, const QRect& cellRange);
+    void _removeCellRange(ElaGraphicsItem* item, const QRect& cellRange);
+    static quint64 _getCellKey(int x, int y);
+    static void _sortByStackingOrder(QList<ElaGraphicsItem*>& itemList);
+};
+
+#endif // ELAGRAPHICSGRIDINDEX_H
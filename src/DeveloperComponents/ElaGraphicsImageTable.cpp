@@ -0,0 +1,79 @@
+#include "ElaGraphicsImageTable.h"
+
+ElaGraphicsImageTable::ElaGraphicsImageTable()
+{
+}
+
+ElaGraphicsImageTable::~ElaGraphicsImageTable()
+{
+}
+
+qint32 ElaGraphicsImageTable::registerImage(const QImage& image)
+{
+    if (image.isNull())
+    {
+        return -1;
+    }
+    // 隐式共享的副本cacheKey相同 无需计算内容哈希
+    auto cacheIt = _cacheKeyHash.constFind(image.cacheKey());
+    if (cacheIt != _cacheKeyHash.constEnd())
+    {
+        return cacheIt.value();
+    }
+    size_t contentHash = _getContentHash(image);
+    auto contentIt = _contentHash.constFind(contentHash);
+    while (contentIt != _contentHash.constEnd() && contentIt.key() == contentHash)
+    {
+        if (_imageVector[contentIt.value()] == image)
+        {
+            _cacheKeyHash.insert(image.cacheKey(), contentIt.value());
+            return contentIt.value();
+        }
+        ++contentIt;
+    }
+    qint32 imageID = _imageVector.count();
+    _imageVector.append(image);
+    _cacheKeyHash.insert(image.cacheKey(), imageID);
+    _contentHash.insert(contentHash, imageID);
+    return imageID;
+}
+
+QImage ElaGraphicsImageTable::getImage(qint32 imageID) const
+{
+    if (imageID < 0 || imageID >= _imageVector.count())
+    {
+        return QImage();
+    }
+    return _imageVector[imageID];
+}
+
+int ElaGraphicsImageTable::count() const
+{
+    return _imageVector.count();
+}
+
+void ElaGraphicsImageTable::clear()
+{
+    _imageVector.clear();
+    _cacheKeyHash.clear();
+    _contentHash.clear();
+}
+
+size_t ElaGraphicsImageTable::_getContentHash(const QImage& image)
+{
+    size_t seed = qHash(image.width()) ^ (qHash(image.height()) << 1) ^ (qHash(static_cast<int>(image.format())) << 2);
+    return qHashBits(image.constBits(), static_cast<size_t>(image.sizeInBytes()), seed);
+}
+
+QDataStream& operator<<(QDataStream& stream, const ElaGraphicsImageTable& imageTable)
+{
+    stream << imageTable._imageVector;
+    return stream;
+}
+
+QDataStream& operator>>(QDataStream& stream, ElaGraphicsImageTable& imageTable)
+{
+    imageTable.clear();
+    stream >> imageTable._imageVector;
+    return stream;
+}
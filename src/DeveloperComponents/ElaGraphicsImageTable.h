@@ -0,0 +1,31 @@
+#ifndef ELAGRAPHICSIMAGETABLE_H
+#define ELAGRAPHICSIMAGETABLE_H
+
+#include <QDataStream>
+#include <QHash>
+#include <QImage>
+#include <QVector>
+
+// 场景序列化图片表 按内容去重 图元仅保存图片ID
+class ElaGraphicsImageTable
+{
+public:
+    ElaGraphicsImageTable();
+    ~ElaGraphicsImageTable();
+    // 空图片返回-1
+    qint32 registerImage(const QImage& image);
+    QImage getImage(qint32 imageID) const;
+    int count() const;
+    void clear();
+
+    friend QDataStream& operator<<(QDataStream& stream, const ElaGraphicsImageTable& imageTable);
+    friend QDataStream& operator>>(QDataStream& stream, ElaGraphicsImageTable& imageTable);
+
+private:
+    QVector<QImage> _imageVector;
+    QHash<qint64, qint32> _cacheKeyHash;
+    QMultiHash<size_t, qint32> _contentHash;
+    static size_t _getContentHash(const QImage& image);
+};
+
+#endif // ELAGRAPHICSIMAGETABLE_H
@@ -0,0 +1,139 @@
+#include "ElaGraphicsSceneLoader.h"
+
+#include <QDebug>
+#include <QFile>
+
+#include "ElaGraphicsImageTable.h"
+void ElaGraphicsItemData::readAttribute(QDataStream& stream)
+{
+    stream >> itemUID;
+    stream >> itemName;
+    stream >> maxLinkPortCount;
+    stream >> linkPortState;
+    stream >> dataRoutes;
+}
+
+ElaGraphicsSceneLoader::ElaGraphicsSceneLoader(QObject* parent)
+    : QObject{parent}
+{
+    qRegisterMetaType<QSharedPointer<ElaGraphicsSceneData>>("QSharedPointer<ElaGraphicsSceneData>");
+}
+
+ElaGraphicsSceneLoader::~ElaGraphicsSceneLoader()
+{
+}
+
+bool ElaGraphicsSceneLoader::readScene(QDataStream& stream, ElaGraphicsSceneData& sceneData, const std::function<bool()>& isCanceled)
+{
+    quint32 header;
+    stream >> header;
+    if (header != serializeMagic)
+    {
+        // 旧格式以QStringList开头 首个字段即为图元数量
+        if (!_readLegacyScene(stream, header, sceneData, isCanceled))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        quint32 version;
+        qint32 streamVersion;
+        stream >> version >> streamVersion;
+        if (version > serializeVersion)
+        {
+            qWarning() << "ElaGraphicsScene deserialize: unsupported version" << version;
+            return false;
+        }
+        stream.setVersion(streamVersion);
+        ElaGraphicsImageTable imageTable;
+        stream >> imageTable;
+        stream >> sceneData.keyList;
+        sceneData.itemDataVector.resize(sceneData.keyList.count());
+        for (auto& itemData : sceneData.itemDataVector)
+        {
+            if (isCanceled && isCanceled())
+            {
+                return false;
+            }
+            qint32 imageID;
+            qint32 selectedImageID;
+            stream >> itemData.x >> itemData.y >> itemData.z >> itemData.width >> itemData.height;
+            itemData.readAttribute(stream);
+            stream >> imageID >> selectedImageID;
+            // 图片表中的图片在图元间隐式共享
+            itemData.itemImage = imageTable.getImage(imageID);
+            itemData.itemSelectedImage = imageTable.getImage(selectedImageID);
+        }
+    }
+    stream >> sceneData.itemLinkList;
+    return stream.status() == QDataStream::Ok;
+}
+
+quint64 ElaGraphicsSceneLoader::requestLoad()
+{
+    return _latestRequestID.fetchAndAddOrdered(1) + 1;
+}
+
+void ElaGraphicsSceneLoader::cancelLoad()
+{
+    _latestRequestID.fetchAndAddOrdered(1);
+}
+
+void ElaGraphicsSceneLoader::onLoadScene(quint64 requestID, QString filePath)
+{
+    auto isCanceled = [this, requestID]() {
+        return _latestRequestID.loadAcquire() != requestID;
+    };
+    if (isCanceled())
+    {
+        return;
+    }
+    QSharedPointer<ElaGraphicsSceneData> sceneData;
+    QFile file(filePath);
+    if (file.open(QIODevice::ReadOnly))
+    {
+        QDataStream deserialStream(&file);
+        sceneData.reset(new ElaGraphicsSceneData());
+        if (!readScene(deserialStream, *sceneData, isCanceled))
+        {
+            sceneData.reset();
+        }
+        file.close();
+    }
+    else
+    {
+        qDebug() << "deserialize Error";
+    }
+    if (isCanceled())
+    {
+        return;
+    }
+    Q_EMIT loadSceneFinished(requestID, sceneData);
+}
+
+bool ElaGraphicsSceneLoader::_readLegacyScene(QDataStream& stream, quint32 keyCount, ElaGraphicsSceneData& sceneData, const std::function<bool()>& isCanceled)
+{
+    for (quint32 i = 0; i < keyCount; i++)
+    {
+        QString key;
+        stream >> key;
+        if (stream.status() != QDataStream::Ok)
+        {
+            return false;
+        }
+        sceneData.keyList.append(key);
+    }
+    sceneData.itemDataVector.resize(sceneData.keyList.count());
+    for (auto& itemData : sceneData.itemDataVector)
+    {
+        if (isCanceled && isCanceled())
+        {
+            return false;
+        }
+        stream >> itemData.x >> itemData.y >> itemData.z >> itemData.width >> itemData.height;
+        itemData.readAttribute(stream);
+        stream >> itemData.itemImage >> itemData.itemSelectedImage;
+    }
+    return true;
+}
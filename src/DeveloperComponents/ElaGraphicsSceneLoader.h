@@ -0,0 +1,65 @@
+#ifndef ELAGRAPHICSSCENELOADER_H
+#define ELAGRAPHICSSCENELOADER_H
+
+#include <QAtomicInteger>
+#include <QDataStream>
+#include <QImage>
+#include <QObject>
+#include <QSharedPointer>
+#include <QStringList>
+#include <QVariantMap>
+#include <QVector>
+#include <functional>
+
+// 图元纯数据 可在工作线程中构造
+struct ElaGraphicsItemData
+{
+    qreal x{0};
+    qreal y{0};
+    qreal z{0};
+    int width{0};
+    int height{0};
+    QString itemUID;
+    QString itemName;
+    int maxLinkPortCount{1};
+    QVector<bool> linkPortState;
+    QVariantMap dataRoutes;
+    QImage itemImage;
+    QImage itemSelectedImage;
+    // 字段顺序与ElaGraphicsItemPrivate::serializeAttribute一致
+    void readAttribute(QDataStream& stream);
+};
+
+struct ElaGraphicsSceneData
+{
+    QStringList keyList;
+    QVector<ElaGraphicsItemData> itemDataVector;
+    QList<QVariantMap> itemLinkList;
+};
+Q_DECLARE_METATYPE(QSharedPointer<ElaGraphicsSceneData>)
+
+class ElaGraphicsSceneLoader : public QObject
+{
+    Q_OBJECT
+public:
+    explicit ElaGraphicsSceneLoader(QObject* parent = nullptr);
+    ~ElaGraphicsSceneLoader();
+    static constexpr quint32 serializeMagic{0x454C4153}; // "ELAS"
+    static constexpr quint32 serializeVersion{2};
+    // 兼容版本2与旧格式 isCanceled非空时周期性检查 取消或格式错误返回false
+    static bool readScene(QDataStream& stream, ElaGraphicsSceneData& sceneData, const std::function<bool()>& isCanceled = nullptr);
+
+    // GUI线程调用 生成新的请求ID并使之前的请求失效
+    quint64 requestLoad();
+    void cancelLoad();
+    Q_SLOT void onLoadScene(quint64 requestID, QString filePath);
+Q_SIGNALS:
+    // 失败时sceneData为空
+    Q_SIGNAL void loadSceneFinished(quint64 requestID, QSharedPointer<ElaGraphicsSceneData> sceneData);
+
+private:
+    QAtomicInteger<quint64> _latestRequestID{0};
+    static bool _readLegacyScene(QDataStream& stream, quint32 keyCount, ElaGraphicsSceneData& sceneData, const std::function<bool()>& isCanceled);
+};
+
+#endif // ELAGRAPHICSSCENELOADER_H
@@ -0,0 +1,95 @@
+#include "ElaIconGlyphPainter.h"
+
+#include <QGuiApplication>
+#include <QRawFont>
+
+void ElaIconGlyphPainter::drawIcon(QPainter* painter, const QRectF& rect, int alignment, ElaIconType::IconName awesome, int pixelSize)
+{
+    ElaIconGlyph iconGlyph = _getIconGlyph(awesome, pixelSize);
+    if (iconGlyph.glyphRun.isEmpty())
+    {
+        return;
+    }
+    // 与QPainter::drawText一致 水平按字宽对齐 垂直按行高(ascent + descent)对齐
+    qreal glyphX = rect.x();
+    if (alignment & Qt::AlignHCenter)
+    {
+        glyphX += (rect.width() - iconGlyph.advance) / 2;
+    }
+    else if (alignment & Qt::AlignRight)
+    {
+        glyphX += rect.width() - iconGlyph.advance;
+    }
+    qreal lineHeight = iconGlyph.ascent + iconGlyph.descent;
+    qreal glyphY = rect.y();
+    if (alignment & Qt::AlignVCenter)
+    {
+        glyphY += (rect.height() - lineHeight) / 2;
+    }
+    else if (alignment & Qt::AlignBottom)
+    {
+        glyphY += rect.height() - lineHeight;
+    }
+    painter->drawGlyphRun(QPointF(glyphX, glyphY + iconGlyph.ascent), iconGlyph.glyphRun);
+}
+
+void ElaIconGlyphPainter::drawIcon(QPainter* painter, const QPointF& baselinePos, ElaIconType::IconName awesome, int pixelSize)
+{
+    ElaIconGlyph iconGlyph = _getIconGlyph(awesome, pixelSize);
+    if (iconGlyph.glyphRun.isEmpty())
+    {
+        return;
+    }
+    painter->drawGlyphRun(baselinePos, iconGlyph.glyphRun);
+}
+
+void ElaIconGlyphPainter::clearIconGlyphCache()
+{
+    _getIconGlyphCache().clear();
+}
+
+ElaIconGlyphPainter::ElaIconGlyph ElaIconGlyphPainter::_getIconGlyph(ElaIconType::IconName awesome, int pixelSize)
+{
+    QCache<quint32, ElaIconGlyph>& iconGlyphCache = _getIconGlyphCache();
+    quint32 glyphKey = (quint32(quint16(awesome)) << 16) | quint32(quint16(pixelSize));
+    ElaIconGlyph* cacheGlyph = iconGlyphCache.object(glyphKey);
+    if (cacheGlyph)
+    {
+        return *cacheGlyph;
+    }
+    ElaIconGlyph iconGlyph;
+    QFont iconFont = QFont("ElaAwesome");
+    iconFont.setPixelSize(pixelSize);
+    QRawFont rawFont = QRawFont::fromFont(iconFont);
+    if (rawFont.isValid())
+    {
+        QVector<quint32> glyphIndexes = rawFont.glyphIndexesForString(QString(QChar((unsigned short)awesome)));
+        if (!glyphIndexes.isEmpty())
+        {
+            QVector<QPointF> advances = rawFont.advancesForGlyphIndexes(glyphIndexes);
+            iconGlyph.glyphRun.setRawFont(rawFont);
+            iconGlyph.glyphRun.setGlyphIndexes(glyphIndexes.mid(0, 1));
+            iconGlyph.glyphRun.setPositions({QPointF(0, 0)});
+            iconGlyph.advance = advances.isEmpty() ? 0 : advances.first().x();
+            iconGlyph.ascent = rawFont.ascent();
+            iconGlyph.descent = rawFont.descent();
+        }
+    }
+    iconGlyphCache.insert(glyphKey, new ElaIconGlyph(iconGlyph));
+    return iconGlyph;
+}
+
+QCache<quint32, ElaIconGlyphPainter::ElaIconGlyph>& ElaIconGlyphPainter::_getIconGlyphCache()
+{
+    static QCache<quint32, ElaIconGlyph> iconGlyphCache(1024);
+    static bool isConnected = false;
+    if (!isConnected && qApp)
+    {
+        // 字体注册或系统字体变化后 已解析的字形可能来自回退字体
+        isConnected = true;
+        QObject::connect(qApp, &QGuiApplication::fontDatabaseChanged, qApp, []() {
+            _getIconGlyphCache().clear();
+        });
+    }
+    return iconGlyphCache;
+}
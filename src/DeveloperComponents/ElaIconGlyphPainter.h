@@ -0,0 +1,34 @@
+#ifndef ELAICONGLYPHPAINTER_H
+#define ELAICONGLYPHPAINTER_H
+
+#include <QCache>
+#include <QGlyphRun>
+#include <QPainter>
+
+#include "Def.h"
+// ElaAwesome图标绘制 每个(图标, 字号)只整形一次 之后以drawGlyphRun绘制 仅限GUI线程调用
+// 缓存有容量上限 字体库变化时清空 字体晚于首次绘制注册时不会沿用回退字形
+class ElaIconGlyphPainter
+{
+public:
+    // 与painter->drawText(rect, alignment, QChar(awesome))效果一致
+    static void drawIcon(QPainter* painter, const QRectF& rect, int alignment, ElaIconType::IconName awesome, int pixelSize);
+    // 以基线原点绘制 与painter->drawText(baselinePos, QChar(awesome))效果一致
+    static void drawIcon(QPainter* painter, const QPointF& baselinePos, ElaIconType::IconName awesome, int pixelSize);
+    // 重新加载ElaAwesome字体后调用
+    static void clearIconGlyphCache();
+
+private:
+    struct ElaIconGlyph
+    {
+        QGlyphRun glyphRun;
+        qreal advance{0};
+        qreal ascent{0};
+        qreal descent{0};
+    };
+    // 按值返回 QCache插入时可能淘汰已返回的对象
+    static ElaIconGlyph _getIconGlyph(ElaIconType::IconName awesome, int pixelSize);
+    static QCache<quint32, ElaIconGlyph>& _getIconGlyphCache();
+};
+
+#endif // ELAICONGLYPHPAINTER_H
@@ -1,7 +1,8 @@
 #include "ElaMaskWidget.h"
 
 #include <QPainter>
-#include <QPropertyAnimation>
+
+#include "ElaAnimationScheduler.h"
 ElaMaskWidget::ElaMaskWidget(QWidget* parent)
     : QWidget{parent}
 {
@@ -16,21 +17,12 @@ ElaMaskWidget::~ElaMaskWidget()
 
 void ElaMaskWidget::doMaskAnimation(int endValue)
 {
-    QPropertyAnimation* opacityAnimation = new QPropertyAnimation(this, "pMaskAlpha");
-    connect(opacityAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) {
-        update();
-    });
-    connect(opacityAnimation, &QPropertyAnimation::finished, this, [=]() {
+    eAnimationScheduler->startAnimation(this, "pMaskAlpha", _pMaskAlpha, endValue, 250, QEasingCurve::InOutSine, [=](qreal value) { _pMaskAlpha = qRound(value); }, this, [=]() {
         if (endValue == 0)
         {
             setVisible(false);
         }
     });
-    opacityAnimation->setEasingCurve(QEasingCurve::InOutSine);
-    opacityAnimation->setDuration(250);
-    opacityAnimation->setStartValue(_pMaskAlpha);
-    opacityAnimation->setEndValue(endValue);
-    opacityAnimation->start(QAbstractAnimation::DeleteWhenStopped);
 }
 
 void ElaMaskWidget::paintEvent(QPaintEvent* event)
@@ -2,9 +2,10 @@
 
 #include <QPainter>
 #include <QPainterPath>
-#include <QPropertyAnimation>
 #include <QStyleOption>
 
+#include "ElaAnimationScheduler.h"
+#include "ElaIconGlyphPainter.h"
 #include "ElaNavigationModel.h"
 #include "ElaNavigationNode.h"
 #include "ElaNavigationView.h"
@@ -17,40 +18,6 @@ ElaNavigationStyle::ElaNavigationStyle(QStyle* style)
     _pLastSelectMarkBottom = 10.0;
     _pSelectMarkTop = 10.0;
     _pSelectMarkBottom = 10.0;
-
-    // Mark向上
-    _lastSelectMarkTopAnimation = new QPropertyAnimation(this, "pLastSelectMarkTop");
-    connect(_lastSelectMarkTopAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) { _pNavigationView->viewport()->update(); });
-    _lastSelectMarkTopAnimation->setDuration(300);
-    _lastSelectMarkTopAnimation->setEasingCurve(QEasingCurve::InOutSine);
-
-    _selectMarkBottomAnimation = new QPropertyAnimation(this, "pSelectMarkBottom");
-    connect(_selectMarkBottomAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) { _pNavigationView->viewport()->update(); });
-    _selectMarkBottomAnimation->setDuration(300);
-    _selectMarkBottomAnimation->setEasingCurve(QEasingCurve::InOutSine);
-    connect(_lastSelectMarkTopAnimation, &QPropertyAnimation::finished, this, [=]() {
-        _isSelectMarkDisplay = true;
-        _lastSelectedNode = nullptr;
-        _selectMarkBottomAnimation->setStartValue(0);
-        _selectMarkBottomAnimation->setEndValue(10);
-        _selectMarkBottomAnimation->start(); });
-
-    // Mark向下
-    _lastSelectMarkBottomAnimation = new QPropertyAnimation(this, "pLastSelectMarkBottom");
-    connect(_lastSelectMarkBottomAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) { _pNavigationView->viewport()->update(); });
-    _lastSelectMarkBottomAnimation->setDuration(300);
-    _lastSelectMarkBottomAnimation->setEasingCurve(QEasingCurve::InOutSine);
-
-    _selectMarkTopAnimation = new QPropertyAnimation(this, "pSelectMarkTop");
-    connect(_selectMarkTopAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) { _pNavigationView->viewport()->update(); });
-    _selectMarkTopAnimation->setDuration(300);
-    _selectMarkTopAnimation->setEasingCurve(QEasingCurve::InOutSine);
-    connect(_lastSelectMarkBottomAnimation, &QPropertyAnimation::finished, this, [=]() {
-        _isSelectMarkDisplay = true;
-        _lastSelectedNode = nullptr;
-        _selectMarkTopAnimation->setStartValue(0);
-        _selectMarkTopAnimation->setEndValue(10);
-        _selectMarkTopAnimation->start(); });
     _themeMode = eTheme->getThemeMode();
     connect(eTheme, &ElaTheme::themeModeChanged, this, [=](ElaThemeType::ThemeMode themeMode) {
         _themeMode = themeMode;
@@ -188,12 +155,7 @@ void ElaNavigationStyle::drawControl(ControlElement element, const QStyleOption*
             painter->setPen(vopt->index == _pPressIndex ? ElaThemeColor(_themeMode, BasicTextPress) : ElaThemeColor(_themeMode, BasicText));
             if (node->getAwesome() != ElaIconType::None)
             {
-                painter->save();
-                QFont iconFont = QFont("ElaAwesome");
-                iconFont.setPixelSize(17);
-                painter->setFont(iconFont);
-                painter->drawText(QRect(itemRect.x(), itemRect.y(), _iconAreaWidth, itemRect.height()), Qt::AlignCenter, QChar((unsigned short)node->getAwesome()));
-                painter->restore();
+                ElaIconGlyphPainter::drawIcon(painter, QRect(itemRect.x(), itemRect.y(), _iconAreaWidth, itemRect.height()), Qt::AlignCenter, node->getAwesome(), 17);
             }
 
             int viewWidth = widget->width();
@@ -221,9 +183,6 @@ void ElaNavigationStyle::drawControl(ControlElement element, const QStyleOption*
                         QRectF expandIconRect(itemRect.right() - _indicatorIconAreaWidth, itemRect.y(), 17, itemRect.height());
 
                         painter->save();
-                        QFont iconFont = QFont("ElaAwesome");
-                        iconFont.setPixelSize(17);
-                        painter->setFont(iconFont);
                         painter->translate(expandIconRect.x() + (qreal)expandIconRect.width() / 2, expandIconRect.y() + (qreal)expandIconRect.height() / 2);
                         if (node == _expandAnimationTargetNode)
                         {
@@ -243,7 +202,7 @@ void ElaNavigationStyle::drawControl(ControlElement element, const QStyleOption*
                             }
                         }
                         painter->translate(-expandIconRect.x() - (qreal)expandIconRect.width() / 2 + 1, -expandIconRect.y() - (qreal)expandIconRect.height() / 2);
-                        painter->drawText(expandIconRect, Qt::AlignVCenter, QChar((unsigned short)ElaIconType::AngleDown));
+                        ElaIconGlyphPainter::drawIcon(painter, expandIconRect, Qt::AlignVCenter, ElaIconType::AngleDown, 17);
                         painter->restore();
                     }
                     if (node->getIsChildHasKeyPoints())
@@ -326,35 +285,9 @@ void ElaNavigationStyle::navigationNodeStateChange(QVariantMap data)
         ElaNavigationNode* lastExpandNode = _expandAnimationTargetNode;
         _opacityAnimationTargetNode = data.value("Expand").value<ElaNavigationNode*>();
         _expandAnimationTargetNode = _opacityAnimationTargetNode;
-        QPropertyAnimation* nodeOpacityAnimation = new QPropertyAnimation(this, "pOpacity");
-        connect(nodeOpacityAnimation, &QPropertyAnimation::finished, this, [=]() { _opacityAnimationTargetNode = nullptr; });
-        connect(nodeOpacityAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) {
-            _pNavigationView->viewport()->update();
-        });
-        nodeOpacityAnimation->setDuration(600);
-        nodeOpacityAnimation->setEasingCurve(QEasingCurve::InOutSine);
-        nodeOpacityAnimation->setKeyValueAt(0.4, 0);
-        nodeOpacityAnimation->setStartValue(0);
-        nodeOpacityAnimation->setEndValue(1);
-        nodeOpacityAnimation->start(QAbstractAnimation::DeleteWhenStopped);
-
-        QPropertyAnimation* rotateAnimation = new QPropertyAnimation(this, "pRotate");
-        connect(rotateAnimation, &QPropertyAnimation::finished, this, [=]() { _expandAnimationTargetNode = nullptr; });
-        connect(rotateAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) {
-            _pNavigationView->viewport()->update();
-        });
-        rotateAnimation->setDuration(300);
-        rotateAnimation->setEasingCurve(QEasingCurve::InOutSine);
-        if (lastExpandNode == _expandAnimationTargetNode)
-        {
-            rotateAnimation->setStartValue(_pRotate);
-        }
-        else
-        {
-            rotateAnimation->setStartValue(0);
-        }
-        rotateAnimation->setEndValue(-180);
-        rotateAnimation->start(QAbstractAnimation::DeleteWhenStopped);
+        // 前40%保持透明 之后渐显
+        eAnimationScheduler->startAnimation(this, "pOpacity", 0, 1, 600, QEasingCurve::InOutSine, [=](qreal value) { _pOpacity = qMax(0.0, (value - 0.4) / 0.6); }, _pNavigationView->viewport(), [=]() { _opacityAnimationTargetNode = nullptr; });
+        eAnimationScheduler->startAnimation(this, "pRotate", lastExpandNode == _expandAnimationTargetNode ? _pRotate : 0, -180, 300, QEasingCurve::InOutSine, [=](qreal value) { _pRotate = value; }, _pNavigationView->viewport(), [=]() { _expandAnimationTargetNode = nullptr; });
     }
     else if (data.contains("Collapse"))
     {
@@ -363,25 +296,9 @@ void ElaNavigationStyle::navigationNodeStateChange(QVariantMap data)
         _expandAnimationTargetNode = _opacityAnimationTargetNode;
         _pOpacity = 0;
 
-        QPropertyAnimation* rotateAnimation = new QPropertyAnimation(this, "pRotate");
-        connect(rotateAnimation, &QPropertyAnimation::finished, this, [=]() {
+        eAnimationScheduler->startAnimation(this, "pRotate", lastExpandNode == _expandAnimationTargetNode ? _pRotate : -180, 0, 300, QEasingCurve::InOutSine, [=](qreal value) { _pRotate = value; }, _pNavigationView->viewport(), [=]() {
             _pOpacity = 1;
             _expandAnimationTargetNode = nullptr; });
-        connect(rotateAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) {
-            _pNavigationView->viewport()->update();
-        });
-        rotateAnimation->setDuration(300);
-        rotateAnimation->setEasingCurve(QEasingCurve::InOutSine);
-        if (lastExpandNode == _expandAnimationTargetNode)
-        {
-            rotateAnimation->setStartValue(_pRotate);
-        }
-        else
-        {
-            rotateAnimation->setStartValue(-180);
-        }
-        rotateAnimation->setEndValue(0);
-        rotateAnimation->start(QAbstractAnimation::DeleteWhenStopped);
     }
     else if (data.contains("SelectMarkChanged"))
     {
@@ -394,20 +311,24 @@ void ElaNavigationStyle::navigationNodeStateChange(QVariantMap data)
         _pSelectMarkBottom = 10;
         if (direction)
         {
-            _lastSelectMarkTopAnimation->setStartValue(10);
-            _lastSelectMarkTopAnimation->setEndValue(0);
-            _lastSelectMarkTopAnimation->start();
-            _lastSelectMarkBottomAnimation->stop();
-            _selectMarkTopAnimation->stop();
+            eAnimationScheduler->stopAnimation(this, "pLastSelectMarkBottom");
+            eAnimationScheduler->stopAnimation(this, "pSelectMarkTop");
+            eAnimationScheduler->startAnimation(this, "pLastSelectMarkTop", 10, 0, 300, QEasingCurve::InOutSine, [=](qreal value) { _pLastSelectMarkTop = value; }, _pNavigationView->viewport(), [=]() {
+                _isSelectMarkDisplay = true;
+                _lastSelectedNode = nullptr;
+                eAnimationScheduler->startAnimation(this, "pSelectMarkBottom", 0, 10, 300, QEasingCurve::InOutSine, [=](qreal value) { _pSelectMarkBottom = value; }, _pNavigationView->viewport());
+            });
             _isSelectMarkDisplay = false;
         }
         else
         {
-            _lastSelectMarkBottomAnimation->setStartValue(10);
-            _lastSelectMarkBottomAnimation->setEndValue(0);
-            _lastSelectMarkBottomAnimation->start();
-            _lastSelectMarkTopAnimation->stop();
-            _selectMarkBottomAnimation->stop();
+            eAnimationScheduler->stopAnimation(this, "pLastSelectMarkTop");
+            eAnimationScheduler->stopAnimation(this, "pSelectMarkBottom");
+            eAnimationScheduler->startAnimation(this, "pLastSelectMarkBottom", 10, 0, 300, QEasingCurve::InOutSine, [=](qreal value) { _pLastSelectMarkBottom = value; }, _pNavigationView->viewport(), [=]() {
+                _isSelectMarkDisplay = true;
+                _lastSelectedNode = nullptr;
+                eAnimationScheduler->startAnimation(this, "pSelectMarkTop", 0, 10, 300, QEasingCurve::InOutSine, [=](qreal value) { _pSelectMarkTop = value; }, _pNavigationView->viewport());
+            });
             _isSelectMarkDisplay = false;
         }
     }
@@ -6,7 +6,6 @@
 #include "Def.h"
 class ElaNavigationNode;
 class ElaNavigationView;
-class QPropertyAnimation;
 class ElaNavigationStyle : public QProxyStyle
 {
     Q_OBJECT
@@ -38,10 +37,6 @@ private:
     ElaNavigationNode* _opacityAnimationTargetNode{nullptr};
     ElaNavigationNode* _expandAnimationTargetNode{nullptr};
     ElaNavigationNode* _lastSelectedNode{nullptr};
-    QPropertyAnimation* _lastSelectMarkTopAnimation{nullptr};
-    QPropertyAnimation* _lastSelectMarkBottomAnimation{nullptr};
-    QPropertyAnimation* _selectMarkTopAnimation{nullptr};
-    QPropertyAnimation* _selectMarkBottomAnimation{nullptr};
     bool _compareItemY(ElaNavigationNode* node1, ElaNavigationNode* node2);
 };
 
@@ -4,6 +4,7 @@
 #include <QPainter>
 #include <QPropertyAnimation>
 
+#include "ElaApplication.h"
 #include "ElaPivotStyle.h"
 #include "ElaScrollBar.h"
 ElaPivotView::ElaPivotView(QWidget* parent)
@@ -36,7 +37,7 @@ void ElaPivotView::doCurrentIndexChangedAnimation(const QModelIndex& index)
         connect(markAnimation, &QPropertyAnimation::valueChanged, this, [=]() {
             update();
         });
-        markAnimation->setDuration(300);
+        markAnimation->setDuration(eApp->getAnimationDuration(300));
         markAnimation->setEasingCurve(QEasingCurve::InOutSine);
         if (_pPivotStyle->getCurrentIndex() >= 0)
         {
@@ -49,7 +50,7 @@ void ElaPivotView::doCurrentIndexChangedAnimation(const QModelIndex& index)
             markAnimation->setEndValue(newIndexRect.center().x() - _pMarkWidth / 2);
 
             QPropertyAnimation* markWidthAnimation = new QPropertyAnimation(this, "pMarkAnimationWidth");
-            markWidthAnimation->setDuration(300);
+            markWidthAnimation->setDuration(eApp->getAnimationDuration(300));
             markWidthAnimation->setEasingCurve(QEasingCurve::InOutSine);
             markWidthAnimation->setStartValue(0);
             markWidthAnimation->setEndValue(_pMarkWidth);
@@ -64,14 +65,14 @@ void ElaPivotView::doCurrentIndexChangedAnimation(const QModelIndex& index)
         connect(markAnimation, &QPropertyAnimation::valueChanged, this, [=]() {
             update();
         });
-        markAnimation->setDuration(300);
+        markAnimation->setDuration(eApp->getAnimationDuration(300));
         markAnimation->setEasingCurve(QEasingCurve::InOutSine);
         markAnimation->setStartValue(_pMarkX);
         markAnimation->setEndValue(newIndexRect.center().x());
         markAnimation->start(QAbstractAnimation::DeleteWhenStopped);
 
         QPropertyAnimation* markWidthAnimation = new QPropertyAnimation(this, "pMarkAnimationWidth");
-        markWidthAnimation->setDuration(300);
+        markWidthAnimation->setDuration(eApp->getAnimationDuration(300));
         markWidthAnimation->setEasingCurve(QEasingCurve::InOutSine);
         markWidthAnimation->setStartValue(_pMarkAnimationWidth);
         markWidthAnimation->setEndValue(0);
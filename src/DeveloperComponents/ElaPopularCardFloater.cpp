@@ -6,6 +6,7 @@
 #include <QPainterPath>
 #include <QPropertyAnimation>
 
+#include "ElaApplication.h"
 #include "ElaPopularCard.h"
 #include "ElaPopularCardPrivate.h"
 #include "ElaPushButton.h"
@@ -59,7 +60,7 @@ void ElaPopularCardFloater::showFloater()
         update();
     });
     geometryAnimation->setEasingCurve(QEasingCurve::OutQuad);
-    geometryAnimation->setDuration(300);
+    geometryAnimation->setDuration(eApp->getAnimationDuration(300));
     QRect cardGeometry = QRect(_card->mapTo(_cardPrivate->_pCardFloatArea, QPoint(0, 0)), _card->size());
     QRect endGeometry = _calculateTargetGeometry(cardGeometry);
     QRect startGeometry = QRect(endGeometry.x() + _floatGeometryOffset, endGeometry.y() + _floatGeometryOffset, _card->width(), _card->height());
@@ -70,7 +71,7 @@ void ElaPopularCardFloater::showFloater()
     //Button动画
     QPropertyAnimation* buttonAnimation = new QPropertyAnimation(_overButton, "geometry");
     buttonAnimation->setEasingCurve(QEasingCurve::OutQuad);
-    buttonAnimation->setDuration(300);
+    buttonAnimation->setDuration(eApp->getAnimationDuration(300));
     buttonAnimation->setStartValue(_cardPrivate->_interactiveTipsBaseRect);
     buttonAnimation->setEndValue(_cardPrivate->_buttonTargetRect);
     buttonAnimation->start(QAbstractAnimation::DeleteWhenStopped);
@@ -95,14 +96,14 @@ void ElaPopularCardFloater::hideFloater()
         _card->update();
     });
     geometryAnimation->setEasingCurve(QEasingCurve::InOutSine);
-    geometryAnimation->setDuration(300);
+    geometryAnimation->setDuration(eApp->getAnimationDuration(300));
     QRect endGeometry = QRect(_card->mapTo(_cardPrivate->_pCardFloatArea, QPoint(0, 0)), _card->size());
     geometryAnimation->setStartValue(geometry());
     geometryAnimation->setEndValue(endGeometry);
     geometryAnimation->start(QAbstractAnimation::DeleteWhenStopped);
 
     QPropertyAnimation* opacityAnimation = new QPropertyAnimation(this, "pHoverOpacity");
-    opacityAnimation->setDuration(300);
+    opacityAnimation->setDuration(eApp->getAnimationDuration(300, true));
     opacityAnimation->setStartValue(_pHoverOpacity);
     opacityAnimation->setEndValue(0);
     opacityAnimation->start(QAbstractAnimation::DeleteWhenStopped);
@@ -112,7 +113,7 @@ void ElaPopularCardFloater::hideFloater()
     connect(hoverAnimation, &QPropertyAnimation::valueChanged, this, [=]() {
         update();
     });
-    hoverAnimation->setDuration(300);
+    hoverAnimation->setDuration(eApp->getAnimationDuration(300));
     hoverAnimation->setStartValue(_pHoverYOffset);
     hoverAnimation->setEndValue(0);
     hoverAnimation->start(QAbstractAnimation::DeleteWhenStopped);
@@ -120,7 +121,7 @@ void ElaPopularCardFloater::hideFloater()
     //Button动画
     QPropertyAnimation* buttonAnimation = new QPropertyAnimation(_overButton, "geometry");
     buttonAnimation->setEasingCurve(QEasingCurve::InOutSine);
-    buttonAnimation->setDuration(300);
+    buttonAnimation->setDuration(eApp->getAnimationDuration(300));
     buttonAnimation->setStartValue(_overButton->geometry());
     QRectF endRect = _cardPrivate->_interactiveTipsBaseRect;
     endRect.adjust(0, 6, 0, 6);
@@ -129,7 +130,7 @@ void ElaPopularCardFloater::hideFloater()
 
     QPropertyAnimation* buttonOpacityAnimation = new QPropertyAnimation(_overButton->graphicsEffect(), "opacity");
     buttonOpacityAnimation->setEasingCurve(QEasingCurve::InOutSine);
-    buttonOpacityAnimation->setDuration(350);
+    buttonOpacityAnimation->setDuration(eApp->getAnimationDuration(350, true));
     buttonOpacityAnimation->setStartValue(1);
     buttonOpacityAnimation->setEndValue(0);
     buttonOpacityAnimation->start(QAbstractAnimation::DeleteWhenStopped);
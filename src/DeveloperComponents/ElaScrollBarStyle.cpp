@@ -2,10 +2,10 @@
 
 #include <QPainter>
 #include <QPainterPath>
-#include <QPropertyAnimation>
 #include <QStyleOptionSlider>
 #include <QtMath>
 
+#include "ElaAnimationScheduler.h"
 #include "ElaScrollBar.h"
 #include "ElaTheme.h"
 ElaScrollBarStyle::ElaScrollBarStyle(QStyle* style)
@@ -150,43 +150,14 @@ void ElaScrollBarStyle::startExpandAnimation(bool isExpand)
     if (isExpand)
     {
         _pIsExpand = true;
-        QPropertyAnimation* opacityAnimation = new QPropertyAnimation(this, "pOpacity");
-        connect(opacityAnimation, &QPropertyAnimation::valueChanged, this, [=]() {
-            _pScrollBar->update();
-        });
-        opacityAnimation->setDuration(250);
-        opacityAnimation->setEasingCurve(QEasingCurve::InOutSine);
-        opacityAnimation->setStartValue(_pOpacity);
-        opacityAnimation->setEndValue(1);
-        opacityAnimation->start(QAbstractAnimation::DeleteWhenStopped);
-
-        QPropertyAnimation* extentAnimation = new QPropertyAnimation(this, "pSliderExtent");
-        extentAnimation->setDuration(250);
-        extentAnimation->setEasingCurve(QEasingCurve::InOutSine);
-        extentAnimation->setStartValue(_pSliderExtent);
-        extentAnimation->setEndValue(_scrollBarExtent - 2 * _sliderMargin);
-        extentAnimation->start(QAbstractAnimation::DeleteWhenStopped);
+        eAnimationScheduler->startAnimation(this, "pOpacity", _pOpacity, 1, 250, QEasingCurve::InOutSine, [=](qreal value) { _pOpacity = value; }, _pScrollBar);
+        eAnimationScheduler->startAnimation(this, "pSliderExtent", _pSliderExtent, _scrollBarExtent - 2 * _sliderMargin, 250, QEasingCurve::InOutSine, [=](qreal value) { _pSliderExtent = value; }, _pScrollBar);
     }
     else
     {
-        QPropertyAnimation* opacityAnimation = new QPropertyAnimation(this, "pOpacity");
-        connect(opacityAnimation, &QPropertyAnimation::finished, this, [=]() {
+        eAnimationScheduler->startAnimation(this, "pOpacity", _pOpacity, 0, 250, QEasingCurve::InOutSine, [=](qreal value) { _pOpacity = value; }, _pScrollBar, [=]() {
             _pIsExpand = false;
         });
-        connect(opacityAnimation, &QPropertyAnimation::valueChanged, this, [=]() {
-            _pScrollBar->update();
-        });
-        opacityAnimation->setDuration(250);
-        opacityAnimation->setEasingCurve(QEasingCurve::InOutSine);
-        opacityAnimation->setStartValue(_pOpacity);
-        opacityAnimation->setEndValue(0);
-        opacityAnimation->start(QAbstractAnimation::DeleteWhenStopped);
-
-        QPropertyAnimation* extentAnimation = new QPropertyAnimation(this, "pSliderExtent");
-        extentAnimation->setDuration(250);
-        extentAnimation->setEasingCurve(QEasingCurve::InOutSine);
-        extentAnimation->setStartValue(_pSliderExtent);
-        extentAnimation->setEndValue(2.4);
-        extentAnimation->start(QAbstractAnimation::DeleteWhenStopped);
+        eAnimationScheduler->startAnimation(this, "pSliderExtent", _pSliderExtent, 2.4, 250, QEasingCurve::InOutSine, [=](qreal value) { _pSliderExtent = value; }, _pScrollBar);
     }
 }
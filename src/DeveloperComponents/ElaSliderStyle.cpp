@@ -4,6 +4,7 @@
 #include <QPropertyAnimation>
 #include <QStyleOptionSlider>
 
+#include "ElaApplication.h"
 #include "ElaTheme.h"
 ElaSliderStyle::ElaSliderStyle(QStyle* style)
 {
@@ -158,6 +159,7 @@ void ElaSliderStyle::_startRadiusAnimation(qreal startRadius, qreal endRadius, Q
                 this->_circleRadius = value.toReal();
                 widget->update(); });
     circleRadiusAnimation->setEasingCurve(QEasingCurve::InOutSine);
+    circleRadiusAnimation->setDuration(eApp->getAnimationDuration(250));
     circleRadiusAnimation->setStartValue(startRadius);
     circleRadiusAnimation->setEndValue(endRadius);
     circleRadiusAnimation->start(QAbstractAnimation::DeleteWhenStopped);
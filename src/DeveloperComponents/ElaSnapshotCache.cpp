@@ -0,0 +1,309 @@
+#include "ElaSnapshotCache.h"
+
+#include <QEvent>
+#include <QGuiApplication>
+#include <QMutex>
+#include <QScreen>
+#include <QWidget>
+
+#include "ElaTheme.h"
+Q_SINGLETON_CREATE_CPP(ElaSnapshotCache)
+ElaSnapshotCache::ElaSnapshotCache(QObject* parent)
+    : QObject{parent}
+{
+    connect(eTheme, &ElaTheme::themeModeChanged, this, [=]() {
+        for (auto& entryHash : _snapshotHash)
+        {
+            for (auto& entry : entryHash)
+            {
+                entry.isValid = false;
+            }
+        }
+    });
+}
+
+ElaSnapshotCache::~ElaSnapshotCache()
+{
+}
+
+QPixmap ElaSnapshotCache::getSnapshot(QWidget* widget, const QRect& rect, const QString& snapshotKey)
+{
+    if (!widget)
+    {
+        return QPixmap();
+    }
+    QRect snapshotRect = rect.isValid() ? rect.intersected(widget->rect()) : widget->rect();
+    if (!_snapshotHash.contains(widget))
+    {
+        connect(widget, &QObject::destroyed, this, [=]() {
+            _releaseSnapshot(widget, true);
+        });
+    }
+    ElaSnapshotEntry& entry = _snapshotHash[widget][snapshotKey];
+    if (entry.isValid && entry.rect == snapshotRect && qFuzzyCompare(entry.pixmap.devicePixelRatio(), widget->devicePixelRatioF()))
+    {
+        _hitCount++;
+        return entry.pixmap;
+    }
+    _renderEntry(widget, entry, snapshotRect);
+    entry.isValid = true;
+    if (!entry.isWatched)
+    {
+        entry.isWatched = true;
+        _watchWidget(widget);
+    }
+    return entry.pixmap;
+}
+
+QPixmap ElaSnapshotCache::renderSnapshot(QWidget* widget, const QRect& rect, const QString& snapshotKey)
+{
+    if (!widget)
+    {
+        return QPixmap();
+    }
+    QRect snapshotRect = rect.isValid() ? rect.intersected(widget->rect()) : widget->rect();
+    if (!_snapshotHash.contains(widget))
+    {
+        connect(widget, &QObject::destroyed, this, [=]() {
+            _releaseSnapshot(widget, true);
+        });
+    }
+    ElaSnapshotEntry& entry = _snapshotHash[widget][snapshotKey];
+    _renderEntry(widget, entry, snapshotRect);
+    return entry.pixmap;
+}
+
+void ElaSnapshotCache::invalidate(QWidget* widget)
+{
+    auto entryHashIt = _snapshotHash.find(widget);
+    if (entryHashIt == _snapshotHash.end())
+    {
+        return;
+    }
+    for (auto& entry : *entryHashIt)
+    {
+        entry.isValid = false;
+    }
+}
+
+void ElaSnapshotCache::releaseSnapshot(QWidget* widget)
+{
+    _releaseSnapshot(widget, false);
+}
+
+void ElaSnapshotCache::clear()
+{
+    const QList<QWidget*> widgetList = _snapshotHash.keys();
+    for (QWidget* widget : widgetList)
+    {
+        releaseSnapshot(widget);
+    }
+    _pixmapPool.clear();
+    _poolCost = 0;
+}
+
+void ElaSnapshotCache::setMaxPoolCost(int maxPoolCost)
+{
+    _maxPoolCost = qMax(-1, maxPoolCost);
+    _trimPool();
+}
+
+int ElaSnapshotCache::getMaxPoolCost() const
+{
+    return static_cast<int>(qMin<qint64>(_getMaxPoolBytes() / 1024, INT_MAX));
+}
+
+int ElaSnapshotCache::getHitCount() const
+{
+    return _hitCount;
+}
+
+int ElaSnapshotCache::getRenderCount() const
+{
+    return _renderCount;
+}
+
+int ElaSnapshotCache::getAllocationCount() const
+{
+    return _allocationCount;
+}
+
+bool ElaSnapshotCache::eventFilter(QObject* watched, QEvent* event)
+{
+    if (event->type() == QEvent::ChildAdded)
+    {
+        // 截图后新增的子控件同样需要监听
+        QObject* child = static_cast<QChildEvent*>(event)->child();
+        if (child->isWidgetType())
+        {
+            child->installEventFilter(this);
+            const QList<QWidget*> childWidgetList = child->findChildren<QWidget*>();
+            for (QWidget* childWidget : childWidgetList)
+            {
+                childWidget->installEventFilter(this);
+            }
+        }
+    }
+    switch (event->type())
+    {
+    case QEvent::Paint:
+    {
+        if (_isRendering)
+        {
+            break;
+        }
+        [[fallthrough]];
+    }
+    case QEvent::Resize:
+    case QEvent::ChildAdded:
+    case QEvent::ChildRemoved:
+    case QEvent::EnabledChange:
+    case QEvent::FontChange:
+    case QEvent::PaletteChange:
+    case QEvent::StyleChange:
+    case QEvent::LanguageChange:
+    case QEvent::ActionAdded:
+    case QEvent::ActionChanged:
+    case QEvent::ActionRemoved:
+    {
+        // 子控件的变化同样使祖先控件的快照失效
+        for (QObject* object = watched; object; object = object->parent())
+        {
+            if (object->isWidgetType())
+            {
+                invalidate(static_cast<QWidget*>(object));
+            }
+        }
+        break;
+    }
+    default:
+    {
+        break;
+    }
+    }
+    return QObject::eventFilter(watched, event);
+}
+
+void ElaSnapshotCache::_renderEntry(QWidget* widget, ElaSnapshotEntry& entry, const QRect& rect)
+{
+    qreal devicePixelRatio = widget->devicePixelRatioF();
+    QSize deviceSize = rect.size() * devicePixelRatio;
+    // 调用方仍持有副本时原地绘制会触发深拷贝 此时改用新的缓冲
+    if (entry.pixmap.isNull() || entry.pixmap.size() != deviceSize || !entry.pixmap.isDetached())
+    {
+        _recyclePixmap(entry.pixmap);
+        entry.pixmap = _acquirePixmap(deviceSize);
+    }
+    entry.pixmap.setDevicePixelRatio(devicePixelRatio);
+    entry.pixmap.fill(Qt::transparent);
+    entry.rect = rect;
+    _isRendering = true;
+    widget->render(&entry.pixmap, QPoint(), QRegion(rect), QWidget::DrawWindowBackground | QWidget::DrawChildren);
+    _isRendering = false;
+    _renderCount++;
+}
+
+void ElaSnapshotCache::_releaseSnapshot(QWidget* widget, bool isDestroyed)
+{
+    auto entryHashIt = _snapshotHash.find(widget);
+    if (entryHashIt == _snapshotHash.end())
+    {
+        return;
+    }
+    bool isWatched = false;
+    for (auto& entry : *entryHashIt)
+    {
+        isWatched |= entry.isWatched;
+        _recyclePixmap(entry.pixmap);
+    }
+    _snapshotHash.erase(entryHashIt);
+    // 析构过程中子控件已销毁 过滤器随之移除
+    if (!isDestroyed)
+    {
+        if (isWatched)
+        {
+            _unwatchWidget(widget);
+        }
+        disconnect(widget, &QObject::destroyed, this, nullptr);
+    }
+}
+
+QPixmap ElaSnapshotCache::_acquirePixmap(const QSize& deviceSize)
+{
+    for (int i = _pixmapPool.count() - 1; i >= 0; i--)
+    {
+        if (_pixmapPool[i].size() == deviceSize)
+        {
+            QPixmap pixmap = _pixmapPool.takeAt(i);
+            _poolCost -= _getPixmapCost(pixmap);
+            return pixmap;
+        }
+    }
+    _allocationCount++;
+    return QPixmap(deviceSize);
+}
+
+void ElaSnapshotCache::_recyclePixmap(QPixmap& pixmap)
+{
+    // 仍被外部持有的缓冲不回收
+    if (!pixmap.isNull() && pixmap.isDetached())
+    {
+        _poolCost += _getPixmapCost(pixmap);
+        _pixmapPool.append(pixmap);
+        _trimPool();
+    }
+    pixmap = QPixmap();
+}
+
+void ElaSnapshotCache::_watchWidget(QWidget* widget)
+{
+    widget->installEventFilter(this);
+    const QList<QWidget*> childWidgetList = widget->findChildren<QWidget*>();
+    for (QWidget* childWidget : childWidgetList)
+    {
+        childWidget->installEventFilter(this);
+    }
+}
+
+void ElaSnapshotCache::_unwatchWidget(QWidget* widget)
+{
+    widget->removeEventFilter(this);
+    const QList<QWidget*> childWidgetList = widget->findChildren<QWidget*>();
+    for (QWidget* childWidget : childWidgetList)
+    {
+        childWidget->removeEventFilter(this);
+    }
+}
+
+qint64 ElaSnapshotCache::_getMaxPoolBytes() const
+{
+    if (_maxPoolCost >= 0)
+    {
+        return static_cast<qint64>(_maxPoolCost) * 1024;
+    }
+    // 主题切换需要新旧两张整窗缓冲 按最大屏幕的设备像素计算 固定上限在4K下放不下一张
+    qint64 screenBytes = 0;
+    const QList<QScreen*> screenList = QGuiApplication::screens();
+    for (QScreen* screen : screenList)
+    {
+        QSize deviceSize = screen->size() * screen->devicePixelRatio();
+        screenBytes = qMax(screenBytes, static_cast<qint64>(deviceSize.width()) * deviceSize.height() * 4);
+    }
+    return qMax<qint64>(2 * screenBytes, 32 * 1024 * 1024);
+}
+
+void ElaSnapshotCache::_trimPool()
+{
+    // 先淘汰最早归还的缓冲
+    qint64 maxPoolBytes = _getMaxPoolBytes();
+    while (!_pixmapPool.isEmpty() && _poolCost > maxPoolBytes)
+    {
+        _poolCost -= _getPixmapCost(_pixmapPool.first());
+        _pixmapPool.removeFirst();
+    }
+}
+
+qint64 ElaSnapshotCache::_getPixmapCost(const QPixmap& pixmap)
+{
+    return static_cast<qint64>(pixmap.width()) * pixmap.height() * pixmap.depth() / 8;
+}
@@ -0,0 +1,69 @@
+#ifndef ELASNAPSHOTCACHE_H
+#define ELASNAPSHOTCACHE_H
+
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QPixmap>
+
+#include "singleton.h"
+#include "stdafx.h"
+
+#define eSnapshotCache ElaSnapshotCache::getInstance()
+// 控件截图缓存 按(控件, 快照键)保留缓冲 尺寸与DPR一致时原地重绘 仅限GUI线程调用
+// 返回的QPixmap与缓存共享数据 调用方用完后应释放持有的副本 否则下次重绘需要重新分配
+class ElaSnapshotCache : public QObject
+{
+    Q_OBJECT
+    Q_SINGLETON_CREATE_H(ElaSnapshotCache)
+private:
+    explicit ElaSnapshotCache(QObject* parent = nullptr);
+    ~ElaSnapshotCache();
+
+public:
+    // rect无效时截取整个控件 控件及其子控件自上次截图后未发生变化时直接返回保留的快照
+    QPixmap getSnapshot(QWidget* widget, const QRect& rect = QRect(), const QString& snapshotKey = QString());
+    // 总是重新渲染 用于同一调用栈内控件状态同步变化的场景
+    QPixmap renderSnapshot(QWidget* widget, const QRect& rect = QRect(), const QString& snapshotKey = QString());
+    void invalidate(QWidget* widget);
+    void releaseSnapshot(QWidget* widget);
+    void clear();
+
+    // 单位KB 默认按最大屏幕容纳两张整屏缓冲 传入负值恢复默认
+    void setMaxPoolCost(int maxPoolCost);
+    int getMaxPoolCost() const;
+    int getHitCount() const;
+    int getRenderCount() const;
+    int getAllocationCount() const;
+
+protected:
+    virtual bool eventFilter(QObject* watched, QEvent* event) override;
+
+private:
+    struct ElaSnapshotEntry
+    {
+        QPixmap pixmap;
+        QRect rect;
+        bool isValid{false};
+        bool isWatched{false};
+    };
+    QHash<QWidget*, QHash<QString, ElaSnapshotEntry>> _snapshotHash;
+    QList<QPixmap> _pixmapPool;
+    qint64 _poolCost{0};
+    int _maxPoolCost{-1};
+    bool _isRendering{false};
+    int _hitCount{0};
+    int _renderCount{0};
+    int _allocationCount{0};
+    void _renderEntry(QWidget* widget, ElaSnapshotEntry& entry, const QRect& rect);
+    void _releaseSnapshot(QWidget* widget, bool isDestroyed);
+    QPixmap _acquirePixmap(const QSize& deviceSize);
+    void _recyclePixmap(QPixmap& pixmap);
+    void _watchWidget(QWidget* widget);
+    void _unwatchWidget(QWidget* widget);
+    qint64 _getMaxPoolBytes() const;
+    void _trimPool();
+    static qint64 _getPixmapCost(const QPixmap& pixmap);
+};
+
+#endif // ELASNAPSHOTCACHE_H
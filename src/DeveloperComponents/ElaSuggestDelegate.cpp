@@ -3,7 +3,7 @@
 #include <QPainter>
 #include <QPainterPath>
 
-#include "ElaSuggestBoxPrivate.h"
+#include "ElaIconGlyphPainter.h"
 #include "ElaSuggestModel.h"
 #include "ElaTheme.h"
 ElaSuggestDelegate::ElaSuggestDelegate(QObject* parent)
@@ -24,7 +24,7 @@ void ElaSuggestDelegate::paint(QPainter* painter, const QStyleOptionViewItem& op
     initStyleOption(&viewOption, index);
 
     ElaSuggestModel* model = dynamic_cast<ElaSuggestModel*>(const_cast<QAbstractItemModel*>(index.model()));
-    ElaSuggestion* suggest = model->getSearchSuggestion(index.row());
+    ElaIconType::IconName icon = model->getElaIcon(index.row());
     if (option.state.testFlag(QStyle::State_HasFocus))
     {
         viewOption.state &= ~QStyle::State_HasFocus;
@@ -58,15 +58,12 @@ void ElaSuggestDelegate::paint(QPainter* painter, const QStyleOptionViewItem& op
     }
     //文字绘制
     painter->setPen(ElaThemeColor(_themeMode, BasicText));
-    painter->drawText(option.rect.x() + 37, option.rect.y() + 25, suggest->getSuggestText());
+    painter->drawText(option.rect.x() + 37, option.rect.y() + 25, model->getSuggestText(index.row()));
 
     //图标绘制
-    if (suggest->getElaIcon() != ElaIconType::None)
+    if (icon != ElaIconType::None)
     {
-        QFont iconFont = QFont("ElaAwesome");
-        iconFont.setPixelSize(17);
-        painter->setFont(iconFont);
-        painter->drawText(option.rect.x() + 11, option.rect.y() + 26, QChar((unsigned short)suggest->getElaIcon()));
+        ElaIconGlyphPainter::drawIcon(painter, QPointF(option.rect.x() + 11, option.rect.y() + 26), icon, 17);
     }
     painter->restore();
 }
@@ -1,5 +1,6 @@
 #include "ElaSuggestModel.h"
 
+#include "ElaSuggestionStore.h"
 ElaSuggestModel::ElaSuggestModel(QObject* parent)
     : QAbstractListModel{parent}
 {
@@ -12,7 +13,7 @@ ElaSuggestModel::~ElaSuggestModel()
 int ElaSuggestModel::rowCount(const QModelIndex& parent) const
 {
     Q_UNUSED(parent)
-    return _suggestionVector.count();
+    return _rowVector.count();
 }
 
 QVariant ElaSuggestModel::data(const QModelIndex& index, int role) const
@@ -20,27 +21,46 @@ QVariant ElaSuggestModel::data(const QModelIndex& index, int role) const
     return QVariant();
 }
 
-void ElaSuggestModel::setSearchSuggestion(QVector<ElaSuggestion*> suggestionVector)
+void ElaSuggestModel::setSearchSuggestion(const ElaSuggestionStore* suggestionStore, QVector<int> rowVector)
 {
-    if (suggestionVector.count() == 0)
+    if (rowVector.count() == 0)
     {
         return;
     }
     beginResetModel();
-    _suggestionVector = suggestionVector;
+    _suggestionStore = suggestionStore;
+    _rowVector = rowVector;
     endResetModel();
 }
 
 void ElaSuggestModel::clearSearchNode()
 {
-    this->_suggestionVector.clear();
+    this->_rowVector.clear();
 }
 
-ElaSuggestion* ElaSuggestModel::getSearchSuggestion(int row)
+QString ElaSuggestModel::getSuggestText(int row) const
 {
-    if (row >= _suggestionVector.count())
+    if (row >= _rowVector.count())
     {
-        return nullptr;
+        return QString();
     }
-    return _suggestionVector[row];
+    return _suggestionStore->getSuggestText(_rowVector[row]);
+}
+
+ElaIconType::IconName ElaSuggestModel::getElaIcon(int row) const
+{
+    if (row >= _rowVector.count())
+    {
+        return ElaIconType::None;
+    }
+    return _suggestionStore->getElaIcon(_rowVector[row]);
+}
+
+QVariantMap ElaSuggestModel::getSuggestData(int row) const
+{
+    if (row >= _rowVector.count())
+    {
+        return QVariantMap();
+    }
+    return _suggestionStore->getSuggestData(_rowVector[row]);
 }
@@ -4,7 +4,7 @@
 #include <QAbstractListModel>
 
 #include "Def.h"
-class ElaSuggestion;
+class ElaSuggestionStore;
 class ElaSuggestModel : public QAbstractListModel
 {
     Q_OBJECT
@@ -13,12 +13,15 @@ public:
     ~ElaSuggestModel();
     int rowCount(const QModelIndex& parent) const;
     QVariant data(const QModelIndex& index, int role) const;
-    void setSearchSuggestion(QVector<ElaSuggestion*> suggestionVector);
+    void setSearchSuggestion(const ElaSuggestionStore* suggestionStore, QVector<int> rowVector);
     void clearSearchNode();
-    ElaSuggestion* getSearchSuggestion(int row);
+    QString getSuggestText(int row) const;
+    ElaIconType::IconName getElaIcon(int row) const;
+    QVariantMap getSuggestData(int row) const;
 
 private:
-    QVector<ElaSuggestion*> _suggestionVector; //符合搜索的节点
+    const ElaSuggestionStore* _suggestionStore{nullptr};
+    QVector<int> _rowVector; //符合搜索的节点
 };
 
 #endif // ELASUGGESTMODEL_H
@@ -0,0 +1,74 @@
+#include "ElaSuggestProviderWorker.h"
+
+#include <QMutexLocker>
+
+static thread_local const QAtomicInteger<quint64>* currentLatestRequestID = nullptr;
+static thread_local quint64 currentRequestID = 0;
+ElaSuggestProviderWorker::ElaSuggestProviderWorker(QObject* parent)
+    : QObject{parent}
+{
+    qRegisterMetaType<Qt::CaseSensitivity>("Qt::CaseSensitivity");
+    qRegisterMetaType<ElaSuggestResult>("ElaSuggestResult");
+    qRegisterMetaType<QVector<ElaSuggestResult>>("QVector<ElaSuggestResult>");
+}
+
+ElaSuggestProviderWorker::~ElaSuggestProviderWorker()
+{
+}
+
+void ElaSuggestProviderWorker::setSuggestProvider(ElaSuggestProvider* provider)
+{
+    cancelQuery();
+    // 等待进行中的查询结束 之后工作线程不再访问旧的数据源
+    QMutexLocker locker(&_providerMutex);
+    _provider = provider;
+}
+
+quint64 ElaSuggestProviderWorker::requestQuery()
+{
+    return _latestRequestID.fetchAndAddOrdered(1) + 1;
+}
+
+void ElaSuggestProviderWorker::cancelQuery()
+{
+    _latestRequestID.fetchAndAddOrdered(1);
+}
+
+bool ElaSuggestProviderWorker::isCurrentQueryCanceled()
+{
+    if (!currentLatestRequestID)
+    {
+        return false;
+    }
+    return currentLatestRequestID->loadAcquire() != currentRequestID;
+}
+
+void ElaSuggestProviderWorker::onQuerySuggestion(quint64 requestID, QString queryText, Qt::CaseSensitivity caseSensitivity, int maxCount)
+{
+    // 队列中已过期的请求直接丢弃
+    if (_latestRequestID.loadAcquire() != requestID)
+    {
+        return;
+    }
+    QVector<ElaSuggestResult> suggestionVector;
+    {
+        QMutexLocker locker(&_providerMutex);
+        if (!_provider)
+        {
+            return;
+        }
+        currentLatestRequestID = &_latestRequestID;
+        currentRequestID = requestID;
+        suggestionVector = _provider->querySuggestion(queryText, caseSensitivity, maxCount);
+        currentLatestRequestID = nullptr;
+    }
+    if (_latestRequestID.loadAcquire() != requestID)
+    {
+        return;
+    }
+    if (suggestionVector.count() > maxCount)
+    {
+        suggestionVector.resize(maxCount);
+    }
+    Q_EMIT querySuggestionFinished(requestID, queryText, suggestionVector);
+}
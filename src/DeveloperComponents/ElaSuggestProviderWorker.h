@@ -0,0 +1,30 @@
+#ifndef ELASUGGESTPROVIDERWORKER_H
+#define ELASUGGESTPROVIDERWORKER_H
+
+#include <QAtomicInteger>
+#include <QMutex>
+#include <QObject>
+
+#include "ElaSuggestProvider.h"
+class ElaSuggestProviderWorker : public QObject
+{
+    Q_OBJECT
+public:
+    explicit ElaSuggestProviderWorker(QObject* parent = nullptr);
+    ~ElaSuggestProviderWorker();
+    void setSuggestProvider(ElaSuggestProvider* provider);
+    // GUI线程调用 生成新的请求ID并使之前的请求失效
+    quint64 requestQuery();
+    void cancelQuery();
+    static bool isCurrentQueryCanceled();
+    Q_SLOT void onQuerySuggestion(quint64 requestID, QString queryText, Qt::CaseSensitivity caseSensitivity, int maxCount);
+Q_SIGNALS:
+    Q_SIGNAL void querySuggestionFinished(quint64 requestID, QString queryText, QVector<ElaSuggestResult> suggestionVector);
+
+private:
+    QMutex _providerMutex;
+    ElaSuggestProvider* _provider{nullptr};
+    QAtomicInteger<quint64> _latestRequestID{0};
+};
+
+#endif // ELASUGGESTPROVIDERWORKER_H
@@ -0,0 +1,179 @@
+#include "ElaSuggestionStore.h"
+
+ElaSuggestionStore::ElaSuggestionStore()
+{
+}
+
+ElaSuggestionStore::~ElaSuggestionStore()
+{
+}
+
+void ElaSuggestionStore::reserve(int count)
+{
+    _textIDVector.reserve(count);
+    _iconVector.reserve(count);
+    _dataOffsetVector.reserve(count);
+}
+
+int ElaSuggestionStore::appendSuggestion(ElaIconType::IconName icon, const QString& suggestText, const QVariantMap& suggestData)
+{
+    int dataOffset = -1;
+    if (!suggestData.isEmpty())
+    {
+        if (_freeDataOffsetVector.isEmpty())
+        {
+            dataOffset = _dataPool.count();
+            _dataPool.append(suggestData);
+        }
+        else
+        {
+            dataOffset = _freeDataOffsetVector.takeLast();
+            _dataPool[dataOffset] = suggestData;
+        }
+    }
+    _textIDVector.append(_internText(suggestText));
+    _iconVector.append(static_cast<quint16>(icon));
+    _dataOffsetVector.append(dataOffset);
+    return _textIDVector.count() - 1;
+}
+
+void ElaSuggestionStore::removeSuggestion(int index)
+{
+    if (index < 0 || index >= _textIDVector.count())
+    {
+        return;
+    }
+    _releaseText(_textIDVector[index]);
+    int dataOffset = _dataOffsetVector[index];
+    if (dataOffset >= 0)
+    {
+        _dataPool[dataOffset] = QVariantMap();
+        _freeDataOffsetVector.append(dataOffset);
+    }
+    _textIDVector.remove(index);
+    _iconVector.remove(index);
+    _dataOffsetVector.remove(index);
+}
+
+int ElaSuggestionStore::removeSuggestion(const QString& suggestText)
+{
+    auto it = _textIDHash.constFind(suggestText);
+    if (it == _textIDHash.constEnd())
+    {
+        return 0;
+    }
+    int textID = it.value();
+    int removeCount = 0;
+    for (int i = _textIDVector.count() - 1; i >= 0; i--)
+    {
+        if (_textIDVector[i] == textID)
+        {
+            removeSuggestion(i);
+            removeCount++;
+        }
+    }
+    return removeCount;
+}
+
+void ElaSuggestionStore::clear()
+{
+    _textPool.clear();
+    _textRefCountVector.clear();
+    _freeTextIDVector.clear();
+    _textIDHash.clear();
+    _dataPool.clear();
+    _freeDataOffsetVector.clear();
+    _textIDVector.clear();
+    _iconVector.clear();
+    _dataOffsetVector.clear();
+}
+
+int ElaSuggestionStore::count() const
+{
+    return _textIDVector.count();
+}
+
+QString ElaSuggestionStore::getSuggestText(int index) const
+{
+    if (index < 0 || index >= _textIDVector.count())
+    {
+        return QString();
+    }
+    return _textPool[_textIDVector[index]];
+}
+
+ElaIconType::IconName ElaSuggestionStore::getElaIcon(int index) const
+{
+    if (index < 0 || index >= _iconVector.count())
+    {
+        return ElaIconType::None;
+    }
+    return static_cast<ElaIconType::IconName>(_iconVector[index]);
+}
+
+QVariantMap ElaSuggestionStore::getSuggestData(int index) const
+{
+    if (index < 0 || index >= _dataOffsetVector.count() || _dataOffsetVector[index] < 0)
+    {
+        return QVariantMap();
+    }
+    return _dataPool[_dataOffsetVector[index]];
+}
+
+QVector<int> ElaSuggestionStore::searchSuggestion(const QString& searchText, Qt::CaseSensitivity caseSensitivity) const
+{
+    QVector<char> textMatchVector(_textPool.count(), 0);
+    for (int i = 0; i < _textPool.count(); i++)
+    {
+        if (_textRefCountVector[i] > 0 && _textPool[i].contains(searchText, caseSensitivity))
+        {
+            textMatchVector[i] = 1;
+        }
+    }
+    QVector<int> rowVector;
+    for (int i = 0; i < _textIDVector.count(); i++)
+    {
+        if (textMatchVector[_textIDVector[i]])
+        {
+            rowVector.append(i);
+        }
+    }
+    return rowVector;
+}
+
+int ElaSuggestionStore::_internText(const QString& suggestText)
+{
+    auto it = _textIDHash.constFind(suggestText);
+    if (it != _textIDHash.constEnd())
+    {
+        _textRefCountVector[it.value()]++;
+        return it.value();
+    }
+    int textID;
+    if (_freeTextIDVector.isEmpty())
+    {
+        textID = _textPool.count();
+        _textPool.append(suggestText);
+        _textRefCountVector.append(1);
+    }
+    else
+    {
+        textID = _freeTextIDVector.takeLast();
+        _textPool[textID] = suggestText;
+        _textRefCountVector[textID] = 1;
+    }
+    _textIDHash.insert(suggestText, textID);
+    return textID;
+}
+
+void ElaSuggestionStore::_releaseText(int textID)
+{
+    _textRefCountVector[textID]--;
+    if (_textRefCountVector[textID] > 0)
+    {
+        return;
+    }
+    _textIDHash.remove(_textPool[textID]);
+    _textPool[textID].clear();
+    _freeTextIDVector.append(textID);
+}
@@ -0,0 +1,46 @@
+#ifndef ELASUGGESTIONSTORE_H
+#define ELASUGGESTIONSTORE_H
+
+#include <QHash>
+#include <QStringList>
+#include <QVariantMap>
+#include <QVector>
+
+#include "Def.h"
+// 建议项列式存储 文本驻留去重 图标以16位保存 附加数据按偏移索引 无附加数据时不占用QVariantMap
+class ElaSuggestionStore
+{
+public:
+    ElaSuggestionStore();
+    ~ElaSuggestionStore();
+    void reserve(int count);
+    int appendSuggestion(ElaIconType::IconName icon, const QString& suggestText, const QVariantMap& suggestData = {});
+    void removeSuggestion(int index);
+    // 移除全部文本相同的建议项 返回移除数量
+    int removeSuggestion(const QString& suggestText);
+    void clear();
+
+    int count() const;
+    QString getSuggestText(int index) const;
+    ElaIconType::IconName getElaIcon(int index) const;
+    QVariantMap getSuggestData(int index) const;
+
+    // 每个驻留文本只匹配一次 返回命中的行号
+    QVector<int> searchSuggestion(const QString& searchText, Qt::CaseSensitivity caseSensitivity) const;
+
+private:
+    QStringList _textPool;
+    QVector<int> _textRefCountVector;
+    QVector<int> _freeTextIDVector;
+    QHash<QString, int> _textIDHash;
+    QVector<QVariantMap> _dataPool;
+    QVector<int> _freeDataOffsetVector;
+
+    QVector<int> _textIDVector;
+    QVector<quint16> _iconVector;
+    QVector<int> _dataOffsetVector;
+    int _internText(const QString& suggestText);
+    void _releaseText(int textID);
+};
+
+#endif // ELASUGGESTIONSTORE_H
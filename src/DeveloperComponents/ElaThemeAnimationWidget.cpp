@@ -1,11 +1,15 @@
 #include "ElaThemeAnimationWidget.h"
 
+#include <QPaintEvent>
 #include <QPainter>
 #include <QPainterPath>
 #include <QPropertyAnimation>
+#include <QtMath>
 ElaThemeAnimationWidget::ElaThemeAnimationWidget(QWidget* parent)
     : QWidget{parent}
 {
+    setAttribute(Qt::WA_OpaquePaintEvent);
+    _pRadius = 0;
     _pEndRadius = 0.01;
 }
 
@@ -15,6 +19,7 @@ ElaThemeAnimationWidget::~ElaThemeAnimationWidget()
 
 void ElaThemeAnimationWidget::startAnimation(int msec)
 {
+    _lastRadius = 0;
     QPropertyAnimation* themeChangeAnimation = new QPropertyAnimation(this, "pRadius");
     themeChangeAnimation->setDuration(msec);
     themeChangeAnimation->setEasingCurve(QEasingCurve::InOutSine);
@@ -22,23 +27,61 @@ void ElaThemeAnimationWidget::startAnimation(int msec)
         Q_EMIT animationFinished();
         this->deleteLater();
     });
-    connect(themeChangeAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) { update(); });
+    connect(themeChangeAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) {
+        // 上一帧内接正方形以内已是新背景 只刷新新增的环形区域
+        update(getRevealRegion(_lastRadius, _pRadius));
+        _lastRadius = _pRadius;
+    });
     themeChangeAnimation->setStartValue(0);
     themeChangeAnimation->setEndValue(_pEndRadius);
     themeChangeAnimation->start(QAbstractAnimation::DeleteWhenStopped);
 }
 
+QRegion ElaThemeAnimationWidget::getRevealRegion(qreal lastRadius, qreal radius) const
+{
+    // 外扩1像素覆盖高DPI下的取整误差
+    qreal outerRadius = radius + 1;
+    QRect outerRect = QRectF(_pCenter.x() - outerRadius, _pCenter.y() - outerRadius, outerRadius * 2, outerRadius * 2).toAlignedRect().intersected(rect());
+    return QRegion(outerRect).subtracted(QRegion(_getInnerRect(lastRadius)));
+}
+
 void ElaThemeAnimationWidget::paintEvent(QPaintEvent* event)
 {
     QPainter painter(this);
-    painter.save();
-    painter.setRenderHints(QPainter::Antialiasing);
-    painter.setPen(Qt::NoPen);
-    painter.drawImage(rect(), _pOldWindowBackground);
-    QPainterPath path;
-    path.moveTo(_pCenter.x(), _pCenter.y());
-    path.addEllipse(QPointF(_pCenter.x(), _pCenter.y()), _pRadius, _pRadius);
-    painter.setClipPath(path);
-    painter.drawImage(rect(), _pNewWindowBackground);
-    painter.restore();
+    QRect innerRect = _getInnerRect(_pRadius);
+    QRegion innerRegion = event->region().intersected(innerRect);
+    if (!innerRegion.isEmpty())
+    {
+        painter.setClipRegion(innerRegion);
+        painter.drawPixmap(0, 0, _pNewWindowBackground);
+    }
+    // 仅圆周附近需要路径裁剪
+    QRegion edgeRegion = event->region().subtracted(innerRect);
+    if (!edgeRegion.isEmpty())
+    {
+        painter.setClipRegion(edgeRegion);
+        painter.drawPixmap(0, 0, _pOldWindowBackground);
+        if (_pRadius > 0)
+        {
+            QPainterPath path;
+            path.addEllipse(QPointF(_pCenter), _pRadius, _pRadius);
+            painter.setClipPath(path, Qt::IntersectClip);
+            painter.drawPixmap(0, 0, _pNewWindowBackground);
+        }
+    }
+}
+
+QRect ElaThemeAnimationWidget::_getInnerRect(qreal radius) const
+{
+    // 圆的内接正方形 向内取整保证完全位于圆内
+    qreal halfSide = radius / M_SQRT2;
+    int left = qCeil(_pCenter.x() - halfSide);
+    int top = qCeil(_pCenter.y() - halfSide);
+    int right = qFloor(_pCenter.x() + halfSide) - 1;
+    int bottom = qFloor(_pCenter.y() + halfSide) - 1;
+    if (right < left || bottom < top)
+    {
+        return QRect();
+    }
+    return QRect(QPoint(left, top), QPoint(right, bottom));
 }
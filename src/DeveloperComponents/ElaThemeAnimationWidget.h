@@ -1,26 +1,33 @@
 #ifndef ELATHEMEANIMATIONWIDGET_H
 #define ELATHEMEANIMATIONWIDGET_H
 
+#include <QPixmap>
 #include <QWidget>
 
 #include "stdafx.h"
-class ElaThemeAnimationWidget : public QWidget
+class ELA_BENCHMARK_EXPORT ElaThemeAnimationWidget : public QWidget
 {
     Q_OBJECT
     Q_PROPERTY_CREATE(qreal, Radius)
     Q_PROPERTY_CREATE(qreal, EndRadius)
     Q_PROPERTY_CREATE(QPoint, Center)
-    Q_PROPERTY_CREATE(QImage, OldWindowBackground)
-    Q_PROPERTY_CREATE(QImage, NewWindowBackground)
+    Q_PROPERTY_CREATE(QPixmap, OldWindowBackground)
+    Q_PROPERTY_CREATE(QPixmap, NewWindowBackground)
 public:
     explicit ElaThemeAnimationWidget(QWidget* parent = nullptr);
     ~ElaThemeAnimationWidget();
     void startAnimation(int msec);
+    // 半径由lastRadius扩展到radius时需要重绘的环形区域
+    QRegion getRevealRegion(qreal lastRadius, qreal radius) const;
 Q_SIGNALS:
     Q_SIGNAL void animationFinished();
 
 protected:
     virtual void paintEvent(QPaintEvent* event) override;
+
+private:
+    qreal _lastRadius{0};
+    QRect _getInnerRect(qreal radius) const;
 };
 
 #endif // ELATHEMEANIMATIONWIDGET_H
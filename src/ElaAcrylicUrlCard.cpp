@@ -5,6 +5,7 @@
 #include <QPainterPath>
 #include <QUrl>
 
+#include "ElaImageCache.h"
 #include "ElaTheme.h"
 #include "private/ElaAcrylicUrlCardPrivate.h"
 Q_PROPERTY_CREATE_Q_CPP(ElaAcrylicUrlCard, int, BorderRadius)
@@ -27,7 +28,7 @@ ElaAcrylicUrlCard::ElaAcrylicUrlCard(QWidget* parent)
 {
     Q_D(ElaAcrylicUrlCard);
     d->q_ptr = this;
-    d->_noisePix = QPixmap(":/include/Image/noise.png");
+    d->_noisePix = eImageCache->getPixmap(":/include/Image/noise.png");
     d->_pBorderRadius = 5;
     d->_pMainOpacity = 0.95;
     d->_pNoiseOpacity = 0.06;
@@ -0,0 +1,156 @@
+#include "ElaAnimationScheduler.h"
+
+#include "ElaAnimationSchedulerPrivate.h"
+#include "ElaApplication.h"
+Q_SINGLETON_CREATE_CPP(ElaAnimationScheduler)
+ElaAnimationScheduler::ElaAnimationScheduler(QObject* parent)
+    : QObject{parent}, d_ptr(new ElaAnimationSchedulerPrivate())
+{
+    Q_D(ElaAnimationScheduler);
+    d->q_ptr = this;
+    d->_driver = new ElaAnimationDriver(d);
+    connect(eApp, &ElaApplication::pAnimationPolicyChanged, d, &ElaAnimationSchedulerPrivate::onAnimationPolicyChanged);
+}
+
+ElaAnimationScheduler::~ElaAnimationScheduler()
+{
+    Q_D(ElaAnimationScheduler);
+    d->_driver->stop();
+    delete d->_driver;
+}
+
+quint64 ElaAnimationScheduler::startAnimation(QObject* target, const char* animationKey, qreal startValue, qreal endValue, int duration, const QEasingCurve& easingCurve, ValueSetter valueSetter, QWidget* updateWidget, FinishedCallback finishedCallback)
+{
+    Q_D(ElaAnimationScheduler);
+    if (!target || !valueSetter)
+    {
+        return 0;
+    }
+    if (animationKey)
+    {
+        stopAnimation(target, animationKey);
+    }
+    duration = eApp->getAnimationDuration(duration, true);
+    if (duration <= 0)
+    {
+        // 动画关闭时直接写入终值 不启动帧驱动
+        valueSetter(endValue);
+        if (updateWidget)
+        {
+            updateWidget->update();
+        }
+        if (finishedCallback)
+        {
+            finishedCallback();
+        }
+        return 0;
+    }
+    bool isDriverRunning = d->_driver->state() == QAbstractAnimation::Running;
+    int recordIndex = d->_acquireRecord();
+    ElaAnimationRecord& record = d->_recordVector[recordIndex];
+    record.isActive = true;
+    record.target = target;
+    record.animationKey = animationKey;
+    record.startValue = startValue;
+    record.endValue = endValue;
+    record.duration = duration;
+    record.startTime = isDriverRunning ? d->_driver->currentTime() : 0;
+    record.easingCurve = easingCurve;
+    record.valueSetter = std::move(valueSetter);
+    record.updateWidget = updateWidget;
+    record.finishedCallback = std::move(finishedCallback);
+    quint64 animationID = (static_cast<quint64>(record.generation) << 32) | static_cast<quint32>(recordIndex);
+    d->_activeIndexVector.append(recordIndex);
+    // 与QPropertyAnimation一致 启动时立即写入起始值
+    record.valueSetter(startValue);
+    if (updateWidget)
+    {
+        updateWidget->update();
+    }
+    // 记录入队后再启动 start()会同步触发首帧 队列为空时首帧会停止驱动
+    if (!isDriverRunning)
+    {
+        d->_driver->start();
+    }
+    return animationID;
+}
+
+bool ElaAnimationScheduler::stopAnimation(quint64 animationID)
+{
+    Q_D(ElaAnimationScheduler);
+    int activeIndex = d->_findActiveIndex(animationID);
+    if (activeIndex < 0)
+    {
+        return false;
+    }
+    d->_releaseRecord(activeIndex);
+    return true;
+}
+
+bool ElaAnimationScheduler::stopAnimation(QObject* target, const char* animationKey)
+{
+    Q_D(ElaAnimationScheduler);
+    int activeIndex = d->_findActiveIndex(target, animationKey);
+    if (activeIndex < 0)
+    {
+        return false;
+    }
+    d->_releaseRecord(activeIndex);
+    return true;
+}
+
+void ElaAnimationScheduler::stopAnimations(QObject* target)
+{
+    Q_D(ElaAnimationScheduler);
+    for (int i = d->_activeIndexVector.count() - 1; i >= 0; i--)
+    {
+        if (d->_recordVector[d->_activeIndexVector[i]].target == target)
+        {
+            d->_releaseRecord(i);
+        }
+    }
+}
+
+bool ElaAnimationScheduler::getIsAnimationRunning(quint64 animationID) const
+{
+    Q_D(const ElaAnimationScheduler);
+    return d->_findActiveIndex(animationID) >= 0;
+}
+
+int ElaAnimationScheduler::getActiveAnimationCount() const
+{
+    Q_D(const ElaAnimationScheduler);
+    return d->_activeIndexVector.count();
+}
+
+int ElaAnimationScheduler::getPoolSize() const
+{
+    Q_D(const ElaAnimationScheduler);
+    return d->_recordVector.count();
+}
+
+quint64 ElaAnimationScheduler::getFrameCount() const
+{
+    Q_D(const ElaAnimationScheduler);
+    return d->_frameCount;
+}
+
+qint64 ElaAnimationScheduler::getLastFrameCostNsec() const
+{
+    Q_D(const ElaAnimationScheduler);
+    return d->_lastFrameCostNsec;
+}
+
+qint64 ElaAnimationScheduler::getAverageFrameCostNsec() const
+{
+    Q_D(const ElaAnimationScheduler);
+    return d->_frameCount == 0 ? 0 : static_cast<qint64>(d->_totalFrameCostNsec / d->_frameCount);
+}
+
+void ElaAnimationScheduler::resetStatistics()
+{
+    Q_D(ElaAnimationScheduler);
+    d->_frameCount = 0;
+    d->_lastFrameCostNsec = 0;
+    d->_totalFrameCostNsec = 0;
+}
@@ -3,6 +3,7 @@
 #include <QApplication>
 #include <QDebug>
 
+#include "ElaApplication.h"
 #include "ElaText.h"
 #include "ElaToolButton.h"
 #include "ElaWinShadowHelper.h"
@@ -333,6 +334,12 @@ void ElaAppBar::setRouteBackButtonEnable(bool isEnable)
 void ElaAppBar::closeWindow()
 {
     Q_D(ElaAppBar);
+    int animationDuration = eApp->getAnimationDuration(250, true);
+    if (animationDuration == 0)
+    {
+        window()->close();
+        return;
+    }
     QPropertyAnimation* closeOpacityAnimation = new QPropertyAnimation(window(), "windowOpacity");
     connect(closeOpacityAnimation, &QPropertyAnimation::finished, this, [=]() {
         window()->close();
@@ -340,8 +347,10 @@ void ElaAppBar::closeWindow()
     closeOpacityAnimation->setStartValue(1);
     closeOpacityAnimation->setEndValue(0);
     closeOpacityAnimation->setEasingCurve(QEasingCurve::InOutSine);
+    closeOpacityAnimation->setDuration(animationDuration);
     closeOpacityAnimation->start(QAbstractAnimation::DeleteWhenStopped);
-    if (window()->isMaximized() || window()->isFullScreen() || d->_pIsFixedSize)
+    int geometryDuration = eApp->getAnimationDuration(250);
+    if (geometryDuration == 0 || window()->isMaximized() || window()->isFullScreen() || d->_pIsFixedSize)
     {
         return;
     }
@@ -352,6 +361,7 @@ void ElaAppBar::closeWindow()
     qreal targetHeight = (geometry.height() - window()->minimumHeight()) * 0.7 + window()->minimumHeight();
     geometryAnimation->setEndValue(QRectF(geometry.center().x() - targetWidth / 2, geometry.center().y() - targetHeight / 2, targetWidth, targetHeight));
     geometryAnimation->setEasingCurve(QEasingCurve::InOutSine);
+    geometryAnimation->setDuration(geometryDuration);
     geometryAnimation->start(QAbstractAnimation::DeleteWhenStopped);
 }
 
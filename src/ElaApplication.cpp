@@ -5,6 +5,7 @@
 #include <QFontDatabase>
 #include <QWidget>
 
+#include "ElaIconGlyphPainter.h"
 #include "ElaTheme.h"
 #include "private/ElaApplicationPrivate.h"
 Q_SINGLETON_CREATE_CPP(ElaApplication)
@@ -15,6 +16,7 @@ ElaApplication::ElaApplication(QObject* parent)
     d->q_ptr = this;
     d->_pIsEnableMica = false;
     d->_pMicaImagePath = ":/include/Image/MicaBase.png";
+    d->_pAnimationPolicy = ElaApplicationType::Full;
     d->_themeMode = eTheme->getThemeMode();
     connect(eTheme, &ElaTheme::themeModeChanged, d, &ElaApplicationPrivate::onThemeModeChanged);
 }
@@ -58,10 +60,28 @@ QString ElaApplication::getMicaImagePath() const
     return d->_pMicaImagePath;
 }
 
+void ElaApplication::setAnimationPolicy(ElaApplicationType::AnimationPolicy animationPolicy)
+{
+    Q_D(ElaApplication);
+    if (d->_pAnimationPolicy == animationPolicy)
+    {
+        return;
+    }
+    d->_pAnimationPolicy = animationPolicy;
+    Q_EMIT pAnimationPolicyChanged();
+}
+
+ElaApplicationType::AnimationPolicy ElaApplication::getAnimationPolicy() const
+{
+    Q_D(const ElaApplication);
+    return d->_pAnimationPolicy;
+}
+
 void ElaApplication::init()
 {
     QApplication::setAttribute(Qt::AA_DontCreateNativeWidgetSiblings);
     QFontDatabase::addApplicationFont(":/include/Font/ElaAwesome.ttf");
+    ElaIconGlyphPainter::clearIconGlyphCache();
     //默认字体
     QFont font = qApp->font();
     font.setPixelSize(13);
@@ -107,3 +127,23 @@ bool ElaApplication::containsCursorToItem(QWidget* item)
     }
     return false;
 }
+
+int ElaApplication::getAnimationDuration(int duration, bool isCrossfade) const
+{
+    Q_D(const ElaApplication);
+    switch (d->_pAnimationPolicy)
+    {
+    case ElaApplicationType::Full:
+    {
+        return duration;
+    }
+    case ElaApplicationType::Reduced:
+    {
+        return isCrossfade ? qMin(duration, d->_reducedCrossfadeDuration) : 0;
+    }
+    default:
+    {
+        return 0;
+    }
+    }
+}
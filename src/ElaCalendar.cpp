@@ -128,7 +128,7 @@ void ElaCalendar::setMinimumDate(QDate minimudate)
     {
         return;
     }
-    d->_calendarModel->setMaximumDate(minimudate);
+    d->_calendarModel->setMinimumDate(minimudate);
     Q_EMIT pMinimumDateChanged();
 }
 
@@ -155,6 +155,36 @@ QDate ElaCalendar::getMaximumDate() const
     return d->_calendarModel->getMaximumDate();
 }
 
+void ElaCalendar::setDateAnnotation(QDate date, int count, QString annotationText)
+{
+    Q_D(ElaCalendar);
+    d->_calendarModel->setDateAnnotation(date, count, annotationText);
+}
+
+void ElaCalendar::removeDateAnnotation(QDate date)
+{
+    Q_D(ElaCalendar);
+    d->_calendarModel->removeDateAnnotation(date);
+}
+
+void ElaCalendar::clearDateAnnotation()
+{
+    Q_D(ElaCalendar);
+    d->_calendarModel->clearDateAnnotation();
+}
+
+int ElaCalendar::getDateAnnotationCount(QDate date) const
+{
+    Q_D(const ElaCalendar);
+    return d->_calendarModel->getDateAnnotationCount(date);
+}
+
+QString ElaCalendar::getDateAnnotationText(QDate date) const
+{
+    Q_D(const ElaCalendar);
+    return d->_calendarModel->getDateAnnotationText(date);
+}
+
 void ElaCalendar::paintEvent(QPaintEvent* event)
 {
     Q_D(ElaCalendar);
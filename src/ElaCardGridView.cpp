@@ -0,0 +1,448 @@
+#include "ElaCardGridView.h"
+
+#include <QMouseEvent>
+#include <QPaintEvent>
+#include <QPainter>
+#include <QRubberBand>
+#include <QScrollBar>
+#include <QStyleOption>
+
+#include "ElaCardGridDelegate.h"
+#include "ElaCardGridViewPrivate.h"
+#include "ElaScrollBar.h"
+#include "ElaTheme.h"
+ElaCardGridView::ElaCardGridView(QWidget* parent)
+    : QAbstractItemView(parent), d_ptr(new ElaCardGridViewPrivate())
+{
+    Q_D(ElaCardGridView);
+    d->q_ptr = this;
+    d->_pCardMode = ElaCardGridType::PopularCard;
+    d->_pItemSize = QSize(320, 120);
+    d->_pItemSpacing = 10;
+    setObjectName("ElaCardGridView");
+    setStyleSheet("#ElaCardGridView{background-color:transparent;}");
+    setFrameShape(QFrame::NoFrame);
+    setMouseTracking(true);
+    setVerticalScrollBar(new ElaScrollBar(this));
+    setHorizontalScrollBar(new ElaScrollBar(this));
+    setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    setVerticalScrollBarPolicy(Qt::ScrollBarAsNeeded);
+    setHorizontalScrollMode(QAbstractItemView::ScrollPerPixel);
+    setVerticalScrollMode(QAbstractItemView::ScrollPerPixel);
+    setSelectionMode(QAbstractItemView::NoSelection);
+    d->_cardGridDelegate = new ElaCardGridDelegate(this);
+    d->_cardGridDelegate->setCardMode(d->_pCardMode);
+    d->_cardGridDelegate->setItemSize(d->_pItemSize);
+    setItemDelegate(d->_cardGridDelegate);
+    connect(eTheme, &ElaTheme::themeModeChanged, this, [=]() {
+        viewport()->update();
+    });
+}
+
+ElaCardGridView::~ElaCardGridView()
+{
+}
+
+void ElaCardGridView::setCardMode(ElaCardGridType::CardMode cardMode)
+{
+    Q_D(ElaCardGridView);
+    d->_pCardMode = cardMode;
+    d->_cardGridDelegate->setCardMode(cardMode);
+    viewport()->update();
+    Q_EMIT pCardModeChanged();
+}
+
+ElaCardGridType::CardMode ElaCardGridView::getCardMode() const
+{
+    Q_D(const ElaCardGridView);
+    return d->_pCardMode;
+}
+
+void ElaCardGridView::setItemSize(QSize itemSize)
+{
+    Q_D(ElaCardGridView);
+    if (!itemSize.isValid() || itemSize.isEmpty())
+    {
+        return;
+    }
+    d->_pItemSize = itemSize;
+    d->_cardGridDelegate->setItemSize(itemSize);
+    scheduleDelayedItemsLayout();
+    Q_EMIT pItemSizeChanged();
+}
+
+QSize ElaCardGridView::getItemSize() const
+{
+    Q_D(const ElaCardGridView);
+    return d->_pItemSize;
+}
+
+void ElaCardGridView::setItemSpacing(int itemSpacing)
+{
+    Q_D(ElaCardGridView);
+    d->_pItemSpacing = qMax(0, itemSpacing);
+    scheduleDelayedItemsLayout();
+    Q_EMIT pItemSpacingChanged();
+}
+
+int ElaCardGridView::getItemSpacing() const
+{
+    Q_D(const ElaCardGridView);
+    return d->_pItemSpacing;
+}
+
+void ElaCardGridView::setModel(QAbstractItemModel* model)
+{
+    Q_D(ElaCardGridView);
+    if (this->model())
+    {
+        disconnect(this->model(), nullptr, d, nullptr);
+    }
+    d->_hoverIndex = QModelIndex();
+    QAbstractItemView::setModel(model);
+    if (model)
+    {
+        connect(model, &QAbstractItemModel::rowsRemoved, d, [=]() {
+            scheduleDelayedItemsLayout();
+        });
+    }
+}
+
+QRect ElaCardGridView::visualRect(const QModelIndex& index) const
+{
+    Q_D(const ElaCardGridView);
+    if (!index.isValid() || index.parent() != rootIndex())
+    {
+        return QRect();
+    }
+    return d->_getItemRect(index.row()).translated(0, -verticalOffset());
+}
+
+void ElaCardGridView::scrollTo(const QModelIndex& index, ScrollHint hint)
+{
+    Q_D(ElaCardGridView);
+    if (!index.isValid() || index.parent() != rootIndex())
+    {
+        return;
+    }
+    QRect itemRect = d->_getItemRect(index.row());
+    int viewportHeight = viewport()->height();
+    int offset = verticalOffset();
+    switch (hint)
+    {
+    case QAbstractItemView::EnsureVisible:
+    {
+        if (itemRect.top() < offset)
+        {
+            offset = itemRect.top() - d->_viewMargin;
+        }
+        else if (itemRect.bottom() > offset + viewportHeight)
+        {
+            offset = itemRect.bottom() - viewportHeight + d->_viewMargin + 1;
+        }
+        break;
+    }
+    case QAbstractItemView::PositionAtTop:
+    {
+        offset = itemRect.top() - d->_viewMargin;
+        break;
+    }
+    case QAbstractItemView::PositionAtBottom:
+    {
+        offset = itemRect.bottom() - viewportHeight + d->_viewMargin + 1;
+        break;
+    }
+    case QAbstractItemView::PositionAtCenter:
+    {
+        offset = itemRect.center().y() - viewportHeight / 2;
+        break;
+    }
+    }
+    verticalScrollBar()->setValue(offset);
+}
+
+QModelIndex ElaCardGridView::indexAt(const QPoint& point) const
+{
+    Q_D(const ElaCardGridView);
+    int x = point.x() - d->_viewMargin;
+    int y = point.y() + verticalOffset() - d->_viewMargin;
+    if (!model() || x < 0 || y < 0)
+    {
+        return QModelIndex();
+    }
+    int stepX = d->_pItemSize.width() + d->_pItemSpacing;
+    int stepY = d->_pItemSize.height() + d->_pItemSpacing;
+    int column = x / stepX;
+    // 落在间距上不命中
+    if (column >= d->_getColumnCount() || x % stepX >= d->_pItemSize.width() || y % stepY >= d->_pItemSize.height())
+    {
+        return QModelIndex();
+    }
+    int row = (y / stepY) * d->_getColumnCount() + column;
+    if (row >= d->_getItemCount())
+    {
+        return QModelIndex();
+    }
+    return model()->index(row, 0, rootIndex());
+}
+
+QModelIndex ElaCardGridView::moveCursor(CursorAction cursorAction, Qt::KeyboardModifiers modifiers)
+{
+    Q_D(ElaCardGridView);
+    int itemCount = d->_getItemCount();
+    if (itemCount == 0)
+    {
+        return QModelIndex();
+    }
+    QModelIndex current = currentIndex();
+    if (!current.isValid())
+    {
+        return model()->index(0, 0, rootIndex());
+    }
+    int columnCount = d->_getColumnCount();
+    int pageLineCount = qMax(1, viewport()->height() / (d->_pItemSize.height() + d->_pItemSpacing));
+    int row = current.row();
+    switch (cursorAction)
+    {
+    case QAbstractItemView::MoveLeft:
+    case QAbstractItemView::MovePrevious:
+    {
+        row--;
+        break;
+    }
+    case QAbstractItemView::MoveRight:
+    case QAbstractItemView::MoveNext:
+    {
+        row++;
+        break;
+    }
+    case QAbstractItemView::MoveUp:
+    {
+        row -= columnCount;
+        break;
+    }
+    case QAbstractItemView::MoveDown:
+    {
+        row += columnCount;
+        break;
+    }
+    case QAbstractItemView::MovePageUp:
+    {
+        row -= columnCount * pageLineCount;
+        break;
+    }
+    case QAbstractItemView::MovePageDown:
+    {
+        row += columnCount * pageLineCount;
+        break;
+    }
+    case QAbstractItemView::MoveHome:
+    {
+        row = 0;
+        break;
+    }
+    case QAbstractItemView::MoveEnd:
+    {
+        row = itemCount - 1;
+        break;
+    }
+    }
+    return model()->index(qBound(0, row, itemCount - 1), 0, rootIndex());
+}
+
+int ElaCardGridView::horizontalOffset() const
+{
+    return 0;
+}
+
+int ElaCardGridView::verticalOffset() const
+{
+    return verticalScrollBar()->value();
+}
+
+bool ElaCardGridView::isIndexHidden(const QModelIndex& index) const
+{
+    return false;
+}
+
+void ElaCardGridView::setSelection(const QRect& rect, QItemSelectionModel::SelectionFlags command)
+{
+    Q_D(ElaCardGridView);
+    if (!model() || !selectionModel())
+    {
+        return;
+    }
+    QItemSelection selection;
+    QRect contentRect = rect.normalized().translated(0, verticalOffset());
+    int firstLine = 0;
+    int lastLine = 0;
+    int stepX = d->_pItemSize.width() + d->_pItemSpacing;
+    int stepY = d->_pItemSize.height() + d->_pItemSpacing;
+    if (contentRect.right() >= d->_viewMargin && d->_getLineRange(contentRect, firstLine, lastLine))
+    {
+        // 按行生成连续区间 选择量与行数相关而非项数
+        int columnCount = d->_getColumnCount();
+        int itemCount = d->_getItemCount();
+        int firstColumn = qMax(0, (contentRect.left() - d->_viewMargin) / stepX);
+        int lastColumn = qMin(columnCount - 1, (contentRect.right() - d->_viewMargin) / stepX);
+        // 起点落在间距上时 该行列之前的卡片与rect不相交 与indexAt的命中规则一致
+        if (contentRect.left() >= d->_viewMargin && (contentRect.left() - d->_viewMargin) % stepX >= d->_pItemSize.width())
+        {
+            firstColumn++;
+        }
+        if (contentRect.top() >= d->_viewMargin && (contentRect.top() - d->_viewMargin) % stepY >= d->_pItemSize.height())
+        {
+            firstLine++;
+        }
+        for (int line = firstLine; line <= lastLine && firstColumn <= lastColumn; line++)
+        {
+            int startRow = line * columnCount + firstColumn;
+            int endRow = qMin(itemCount - 1, line * columnCount + lastColumn);
+            if (startRow <= endRow)
+            {
+                selection.select(model()->index(startRow, 0, rootIndex()), model()->index(endRow, 0, rootIndex()));
+            }
+        }
+    }
+    selectionModel()->select(selection, command);
+}
+
+QRegion ElaCardGridView::visualRegionForSelection(const QItemSelection& selection) const
+{
+    Q_D(const ElaCardGridView);
+    QRegion region;
+    int firstLine = 0;
+    int lastLine = 0;
+    if (!d->_getLineRange(viewport()->rect().translated(0, verticalOffset()), firstLine, lastLine))
+    {
+        return region;
+    }
+    // 仅计算可见部分
+    int columnCount = d->_getColumnCount();
+    int firstVisibleRow = firstLine * columnCount;
+    int lastVisibleRow = (lastLine + 1) * columnCount - 1;
+    for (const auto& range : selection)
+    {
+        if (range.parent() != rootIndex())
+        {
+            continue;
+        }
+        int startRow = qMax(range.top(), firstVisibleRow);
+        int endRow = qMin(range.bottom(), lastVisibleRow);
+        for (int row = startRow; row <= endRow; row++)
+        {
+            region += d->_getItemRect(row).translated(0, -verticalOffset());
+        }
+    }
+    return region;
+}
+
+void ElaCardGridView::updateGeometries()
+{
+    Q_D(ElaCardGridView);
+    int lineCount = d->_getLineCount();
+    int stepY = d->_pItemSize.height() + d->_pItemSpacing;
+    int contentHeight = lineCount > 0 ? 2 * d->_viewMargin + lineCount * stepY - d->_pItemSpacing : 0;
+    verticalScrollBar()->setSingleStep(qMax(1, stepY / 3));
+    verticalScrollBar()->setPageStep(viewport()->height());
+    verticalScrollBar()->setRange(0, qMax(0, contentHeight - viewport()->height()));
+    horizontalScrollBar()->setRange(0, 0);
+    QAbstractItemView::updateGeometries();
+}
+
+void ElaCardGridView::rowsInserted(const QModelIndex& parent, int start, int end)
+{
+    scheduleDelayedItemsLayout();
+    QAbstractItemView::rowsInserted(parent, start, end);
+}
+
+void ElaCardGridView::paintEvent(QPaintEvent* event)
+{
+    Q_D(ElaCardGridView);
+    QPainter painter(viewport());
+    int firstLine = 0;
+    int lastLine = 0;
+    if (model() && d->_getLineRange(event->rect().translated(0, verticalOffset()), firstLine, lastLine))
+    {
+        QStyleOptionViewItem option;
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+        initViewItemOption(&option);
+#else
+        option = viewOptions();
+#endif
+        QStyle::State baseState = option.state & ~(QStyle::State_Selected | QStyle::State_MouseOver | QStyle::State_HasFocus);
+        QModelIndex current = currentIndex();
+        int columnCount = d->_getColumnCount();
+        int endRow = qMin(d->_getItemCount(), (lastLine + 1) * columnCount);
+        // 只遍历与重绘区域相交的行
+        for (int row = firstLine * columnCount; row < endRow; row++)
+        {
+            QModelIndex index = model()->index(row, 0, rootIndex());
+            option.rect = d->_getItemRect(row).translated(0, -verticalOffset());
+            if (!option.rect.intersects(event->rect()))
+            {
+                continue;
+            }
+            option.state = baseState;
+            if (selectionModel() && selectionModel()->isSelected(index))
+            {
+                option.state |= QStyle::State_Selected;
+            }
+            if (index == d->_hoverIndex)
+            {
+                option.state |= QStyle::State_MouseOver;
+            }
+            if (index == current && hasFocus())
+            {
+                option.state |= QStyle::State_HasFocus;
+            }
+            itemDelegate()->paint(&painter, option, index);
+        }
+    }
+    // 框选区域
+    if (d->_rubberBandRect.isValid())
+    {
+        QStyleOptionRubberBand rubberBandOption;
+        rubberBandOption.initFrom(this);
+        rubberBandOption.shape = QRubberBand::Rectangle;
+        rubberBandOption.opaque = false;
+        rubberBandOption.rect = d->_rubberBandRect.translated(0, -verticalOffset()).intersected(viewport()->rect());
+        style()->drawControl(QStyle::CE_RubberBand, &rubberBandOption, &painter, this);
+    }
+}
+
+void ElaCardGridView::mousePressEvent(QMouseEvent* event)
+{
+    Q_D(ElaCardGridView);
+    d->_pressedPos = event->pos() + QPoint(0, verticalOffset());
+    QAbstractItemView::mousePressEvent(event);
+}
+
+void ElaCardGridView::mouseMoveEvent(QMouseEvent* event)
+{
+    Q_D(ElaCardGridView);
+    d->_updateHoverIndex(indexAt(event->pos()));
+    QAbstractItemView::mouseMoveEvent(event);
+    // 基类按按下点与当前点的矩形调用setSelection 此处仅绘制框选区域
+    if (state() == QAbstractItemView::DragSelectingState && selectionMode() != QAbstractItemView::SingleSelection && selectionMode() != QAbstractItemView::NoSelection)
+    {
+        d->_updateRubberBand(QRect(d->_pressedPos, event->pos() + QPoint(0, verticalOffset())).normalized());
+    }
+}
+
+void ElaCardGridView::mouseReleaseEvent(QMouseEvent* event)
+{
+    Q_D(ElaCardGridView);
+    QAbstractItemView::mouseReleaseEvent(event);
+    d->_updateRubberBand(QRect());
+}
+
+bool ElaCardGridView::viewportEvent(QEvent* event)
+{
+    Q_D(ElaCardGridView);
+    if (event->type() == QEvent::Leave)
+    {
+        d->_updateHoverIndex(QModelIndex());
+    }
+    return QAbstractItemView::viewportEvent(event);
+}
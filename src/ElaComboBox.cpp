@@ -7,6 +7,7 @@
 #include <QMouseEvent>
 #include <QPropertyAnimation>
 
+#include "ElaApplication.h"
 #include "ElaComboBoxStyle.h"
 #include "ElaScrollBar.h"
 #include "ElaTheme.h"
@@ -98,7 +99,7 @@ void ElaComboBox::showPopup()
             fixedSizeAnimation->setStartValue(1);
             fixedSizeAnimation->setEndValue(containerHeight);
             fixedSizeAnimation->setEasingCurve(QEasingCurve::OutCubic);
-            fixedSizeAnimation->setDuration(400);
+            fixedSizeAnimation->setDuration(eApp->getAnimationDuration(400));
             fixedSizeAnimation->start(QAbstractAnimation::DeleteWhenStopped);
 
             QPropertyAnimation* viewPosAnimation = new QPropertyAnimation(view(), "pos");
@@ -110,7 +111,7 @@ void ElaComboBox::showPopup()
             viewPosAnimation->setStartValue(QPoint(viewPos.x(), viewPos.y() - view()->height()));
             viewPosAnimation->setEndValue(viewPos);
             viewPosAnimation->setEasingCurve(QEasingCurve::OutCubic);
-            viewPosAnimation->setDuration(400);
+            viewPosAnimation->setDuration(eApp->getAnimationDuration(400));
             viewPosAnimation->start(QAbstractAnimation::DeleteWhenStopped);
         }
         //指示器动画
@@ -118,13 +119,13 @@ void ElaComboBox::showPopup()
         connect(rotateAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) {
             update();
         });
-        rotateAnimation->setDuration(300);
+        rotateAnimation->setDuration(eApp->getAnimationDuration(300));
         rotateAnimation->setEasingCurve(QEasingCurve::InOutSine);
         rotateAnimation->setStartValue(d->_comboBoxStyle->getExpandIconRotate());
         rotateAnimation->setEndValue(-180);
         rotateAnimation->start(QAbstractAnimation::DeleteWhenStopped);
         QPropertyAnimation* markAnimation = new QPropertyAnimation(d->_comboBoxStyle, "pExpandMarkWidth");
-        markAnimation->setDuration(300);
+        markAnimation->setDuration(eApp->getAnimationDuration(300));
         markAnimation->setEasingCurve(QEasingCurve::InOutSine);
         markAnimation->setStartValue(d->_comboBoxStyle->getExpandMarkWidth());
         markAnimation->setEndValue(width() / 2 - d->_pBorderRadius - 6);
@@ -159,6 +160,7 @@ void ElaComboBox::hidePopup()
             viewPosAnimation->setStartValue(viewPos);
             viewPosAnimation->setEndValue(QPoint(viewPos.x(), viewPos.y() - view()->height()));
             viewPosAnimation->setEasingCurve(QEasingCurve::InCubic);
+            viewPosAnimation->setDuration(eApp->getAnimationDuration(250));
             viewPosAnimation->start(QAbstractAnimation::DeleteWhenStopped);
 
             QPropertyAnimation* fixedSizeAnimation = new QPropertyAnimation(container, "maximumHeight");
@@ -168,6 +170,7 @@ void ElaComboBox::hidePopup()
             fixedSizeAnimation->setStartValue(container->height());
             fixedSizeAnimation->setEndValue(1);
             fixedSizeAnimation->setEasingCurve(QEasingCurve::InCubic);
+            fixedSizeAnimation->setDuration(eApp->getAnimationDuration(250));
             fixedSizeAnimation->start(QAbstractAnimation::DeleteWhenStopped);
             d->_isAllowHidePopup = false;
         }
@@ -176,13 +179,13 @@ void ElaComboBox::hidePopup()
         connect(rotateAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) {
             update();
         });
-        rotateAnimation->setDuration(300);
+        rotateAnimation->setDuration(eApp->getAnimationDuration(300));
         rotateAnimation->setEasingCurve(QEasingCurve::InOutSine);
         rotateAnimation->setStartValue(d->_comboBoxStyle->getExpandIconRotate());
         rotateAnimation->setEndValue(0);
         rotateAnimation->start(QAbstractAnimation::DeleteWhenStopped);
         QPropertyAnimation* markAnimation = new QPropertyAnimation(d->_comboBoxStyle, "pExpandMarkWidth");
-        markAnimation->setDuration(300);
+        markAnimation->setDuration(eApp->getAnimationDuration(300));
         markAnimation->setEasingCurve(QEasingCurve::InOutSine);
         markAnimation->setStartValue(d->_comboBoxStyle->getExpandMarkWidth());
         markAnimation->setEndValue(0);
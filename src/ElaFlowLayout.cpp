@@ -1,6 +1,5 @@
 #include "ElaFlowLayout.h"
 
-#include <QPropertyAnimation>
 #include <QWidget>
 
 #include "private/ElaFlowLayoutPrivate.h"
@@ -13,7 +12,6 @@ ElaFlowLayout::ElaFlowLayout(QWidget* parent, int margin, int hSpacing, int vSpa
     d->_hSpacing = hSpacing;
     d->_vSpacing = vSpacing;
     setContentsMargins(margin, margin, margin, margin);
-    d->_lastHeightMap.insert(this, 0);
 }
 
 ElaFlowLayout::ElaFlowLayout(int margin, int hSpacing, int vSpacing)
@@ -24,7 +22,6 @@ ElaFlowLayout::ElaFlowLayout(int margin, int hSpacing, int vSpacing)
     d->_hSpacing = hSpacing;
     d->_vSpacing = vSpacing;
     setContentsMargins(margin, margin, margin, margin);
-    d->_lastHeightMap.insert(this, 0);
 }
 
 ElaFlowLayout::~ElaFlowLayout()
@@ -40,6 +37,10 @@ void ElaFlowLayout::addItem(QLayoutItem* item)
 {
     Q_D(ElaFlowLayout);
     d->_itemList.append(item);
+    d->_sizeHintVector.append(QSize());
+    d->_itemPointVector.append(QPoint());
+    d->_isSizeHintCacheValid = false;
+    d->_markDirty(d->_itemList.count() - 1);
 }
 int ElaFlowLayout::horizontalSpacing() const
 {
@@ -81,7 +82,21 @@ QLayoutItem* ElaFlowLayout::takeAt(int index)
     Q_D(ElaFlowLayout);
     if (index >= 0 && index < d->_itemList.size())
     {
-        return d->_itemList.takeAt(index);
+        QLayoutItem* item = d->_itemList.takeAt(index);
+        d->_sizeHintVector.remove(index);
+        d->_itemPointVector.remove(index);
+        d->_markDirty(index);
+        if (item->widget())
+        {
+            for (int i = d->_moveDataVector.count() - 1; i >= 0; i--)
+            {
+                if (d->_moveDataVector[i].widget == item->widget())
+                {
+                    d->_moveDataVector.remove(i);
+                }
+            }
+        }
+        return item;
     }
     return nullptr;
 }
@@ -104,9 +119,16 @@ bool ElaFlowLayout::hasHeightForWidth() const
 
 int ElaFlowLayout::heightForWidth(int width) const
 {
-    int height = d_ptr->_doLayout(QRect(0, 0, width, 0), true);
-    d_ptr->_lastHeightMap[const_cast<ElaFlowLayout*>(this)] = height;
-    return height;
+    return d_ptr->_doLayout(QRect(0, 0, width, 0), true);
+}
+
+void ElaFlowLayout::invalidate()
+{
+    Q_D(ElaFlowLayout);
+    // 尺寸提示在下次布局时逐项比对 未变化的项不会触发重排
+    d->_isSizeHintCacheValid = false;
+    d->_testWidth = -1;
+    QLayout::invalidate();
 }
 
 void ElaFlowLayout::setGeometry(const QRect& rect)
@@ -2,15 +2,13 @@
 
 #include <QGraphicsSceneMouseEvent>
 #include <QPainterPath>
+#include <QStyleOptionGraphicsItem>
 #include <QUuid>
 
 #include "ElaGraphicsScene.h"
+#include "ElaImageCache.h"
 #include "private/ElaGraphicsItemPrivate.h"
 #include "private/ElaGraphicsScenePrivate.h"
-Q_PROPERTY_CREATE_Q_CPP(ElaGraphicsItem, int, Width)
-Q_PROPERTY_CREATE_Q_CPP(ElaGraphicsItem, int, Height)
-Q_PROPERTY_CREATE_Q_CPP(ElaGraphicsItem, QImage, ItemImage)
-Q_PROPERTY_CREATE_Q_CPP(ElaGraphicsItem, QImage, ItemSelectedImage)
 Q_PROPERTY_CREATE_Q_CPP(ElaGraphicsItem, QString, ItemName)
 Q_PROPERTY_CREATE_Q_CPP(ElaGraphicsItem, QVariantMap, DataRoutes)
 ElaGraphicsItem::ElaGraphicsItem(QGraphicsItem* parent)
@@ -20,12 +18,12 @@ ElaGraphicsItem::ElaGraphicsItem(QGraphicsItem* parent)
     d->q_ptr = this;
     setAcceptHoverEvents(true);
     setAcceptedMouseButtons(Qt::AllButtons);
-    setFlags(QGraphicsItem::ItemIsMovable | QGraphicsItem::ItemIsFocusable | QGraphicsItem::ItemIsSelectable | ItemAcceptsInputMethod);
+    setFlags(QGraphicsItem::ItemIsMovable | QGraphicsItem::ItemIsFocusable | QGraphicsItem::ItemIsSelectable | QGraphicsItem::ItemSendsGeometryChanges | ItemAcceptsInputMethod);
     d->_pWidth = 50;
     d->_pHeight = 50;
     d->_itemUID = QUuid::createUuid().toString().remove("{").remove("}").remove("-");
-    d->_pItemImage = QImage(":/include/Image/Moon.jpg");
-    d->_pItemSelectedImage = QImage(":/include/Image/Cirno.jpg");
+    d->_pItemImage = eImageCache->getImage(":/include/Image/Moon.jpg");
+    d->_pItemSelectedImage = eImageCache->getImage(":/include/Image/Cirno.jpg");
     d->_pItemName = "";
     d->_pMaxLinkPortCount = 1;
     d->_currentLinkPortState.resize(1);
@@ -44,6 +42,62 @@ ElaGraphicsItem::~ElaGraphicsItem()
 {
 }
 
+void ElaGraphicsItem::setWidth(int width)
+{
+    Q_D(ElaGraphicsItem);
+    prepareGeometryChange();
+    d->_pWidth = width;
+    d->_notifySceneGeometryChanged();
+    Q_EMIT pWidthChanged();
+}
+
+int ElaGraphicsItem::getWidth() const
+{
+    return d_ptr->_pWidth;
+}
+
+void ElaGraphicsItem::setHeight(int height)
+{
+    Q_D(ElaGraphicsItem);
+    prepareGeometryChange();
+    d->_pHeight = height;
+    d->_notifySceneGeometryChanged();
+    Q_EMIT pHeightChanged();
+}
+
+int ElaGraphicsItem::getHeight() const
+{
+    return d_ptr->_pHeight;
+}
+
+void ElaGraphicsItem::setItemImage(QImage itemImage)
+{
+    Q_D(ElaGraphicsItem);
+    d->_pItemImage = itemImage;
+    d->_clearImageLod(false);
+    update();
+    Q_EMIT pItemImageChanged();
+}
+
+QImage ElaGraphicsItem::getItemImage() const
+{
+    return d_ptr->_pItemImage;
+}
+
+void ElaGraphicsItem::setItemSelectedImage(QImage itemSelectedImage)
+{
+    Q_D(ElaGraphicsItem);
+    d->_pItemSelectedImage = itemSelectedImage;
+    d->_clearImageLod(true);
+    update();
+    Q_EMIT pItemSelectedImageChanged();
+}
+
+QImage ElaGraphicsItem::getItemSelectedImage() const
+{
+    return d_ptr->_pItemSelectedImage;
+}
+
 void ElaGraphicsItem::setMaxLinkPortCount(int maxLinkPortCount)
 {
     Q_D(ElaGraphicsItem);
@@ -166,19 +220,34 @@ QRectF ElaGraphicsItem::boundingRect() const
 void ElaGraphicsItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
     Q_D(ElaGraphicsItem);
+    QRectF itemRect = boundingRect();
+    qreal levelOfDetail = option->levelOfDetailFromTransform(painter->worldTransform()) * painter->device()->devicePixelRatioF();
+    QSizeF deviceSize = itemRect.size() * levelOfDetail;
     painter->save();
-    painter->setRenderHints(QPainter::Antialiasing | QPainter::TextAntialiasing | QPainter::SmoothPixmapTransform);
-    if (isSelected())
+    if (deviceSize.width() < ElaGraphicsItemPrivate::_lodFlatThreshold || deviceSize.height() < ElaGraphicsItemPrivate::_lodFlatThreshold)
     {
-        painter->drawImage(boundingRect(), d->_pItemSelectedImage);
+        // 远景 以图片平均色的色块代替
+        painter->fillRect(itemRect, d->_getLodColor(isSelected()));
     }
     else
     {
-        painter->drawImage(boundingRect(), d->_pItemImage);
+        painter->setRenderHints(QPainter::Antialiasing | QPainter::TextAntialiasing | QPainter::SmoothPixmapTransform);
+        const QPixmap& lodPixmap = d->_getLodPixmap(isSelected(), deviceSize);
+        painter->drawPixmap(itemRect, lodPixmap, lodPixmap.rect());
     }
     painter->restore();
 }
 
+QVariant ElaGraphicsItem::itemChange(GraphicsItemChange change, const QVariant& value)
+{
+    Q_D(ElaGraphicsItem);
+    if (change == QGraphicsItem::ItemPositionHasChanged)
+    {
+        d->_notifySceneGeometryChanged();
+    }
+    return QGraphicsObject::itemChange(change, value);
+}
+
 QDataStream& operator<<(QDataStream& stream, const ElaGraphicsItem* item)
 {
     stream << item->x();
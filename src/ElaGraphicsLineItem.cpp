@@ -2,11 +2,10 @@
 
 #include <QGraphicsScene>
 #include <QPainter>
+#include <QStyleOptionGraphicsItem>
 
 #include "ElaGraphicsItem.h"
 #include "ElaGraphicsLineItemPrivate.h"
-Q_PRIVATE_CREATE_Q_CPP(ElaGraphicsLineItem, QPointF, StartPoint);
-Q_PRIVATE_CREATE_Q_CPP(ElaGraphicsLineItem, QPointF, EndPoint);
 Q_PRIVATE_CREATE_Q_CPP(ElaGraphicsLineItem, ElaGraphicsItem*, StartItem);
 Q_PRIVATE_CREATE_Q_CPP(ElaGraphicsLineItem, ElaGraphicsItem*, EndItem);
 Q_PRIVATE_CREATE_Q_CPP(ElaGraphicsLineItem, int, StartItemPort);
@@ -23,6 +22,8 @@ ElaGraphicsLineItem::ElaGraphicsLineItem(ElaGraphicsItem* startItem, ElaGraphics
     d->_linkItemMap.insert(d->_pStartItem, d->_pStartItemPort);
     d->_linkItemMap.insert(d->_pEndItem, d->_pEndItemPort);
     setFlags(QGraphicsItem::ItemIsFocusable | QGraphicsItem::ItemIsSelectable | ItemAcceptsInputMethod);
+    setPen(QPen(Qt::black, 3));
+    d->updateLinkPath();
 }
 
 ElaGraphicsLineItem::ElaGraphicsLineItem(QPointF startPoint, QPointF endPoint, QGraphicsItem* parent)
@@ -34,12 +35,38 @@ ElaGraphicsLineItem::ElaGraphicsLineItem(QPointF startPoint, QPointF endPoint, Q
     d->_pEndPoint = endPoint;
     d->_isCreateWithItem = false;
     setFlags(QGraphicsItem::ItemIsFocusable | QGraphicsItem::ItemIsSelectable | ItemAcceptsInputMethod);
+    setPen(QPen(Qt::black, 3));
+    d->updateLinkPath();
 }
 
 ElaGraphicsLineItem::~ElaGraphicsLineItem()
 {
 }
 
+void ElaGraphicsLineItem::setStartPoint(QPointF startPoint)
+{
+    Q_D(ElaGraphicsLineItem);
+    d->_pStartPoint = startPoint;
+    d->updateLinkPath();
+}
+
+QPointF ElaGraphicsLineItem::getStartPoint() const
+{
+    return d_ptr->_pStartPoint;
+}
+
+void ElaGraphicsLineItem::setEndPoint(QPointF endPoint)
+{
+    Q_D(ElaGraphicsLineItem);
+    d->_pEndPoint = endPoint;
+    d->updateLinkPath();
+}
+
+QPointF ElaGraphicsLineItem::getEndPoint() const
+{
+    return d_ptr->_pEndPoint;
+}
+
 bool ElaGraphicsLineItem::isTargetLink(ElaGraphicsItem* item) const
 {
     Q_D(const ElaGraphicsLineItem);
@@ -72,39 +99,26 @@ bool ElaGraphicsLineItem::isTargetLink(ElaGraphicsItem* item1, ElaGraphicsItem*
 
 void ElaGraphicsLineItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
-    Q_D(ElaGraphicsLineItem);
     painter->save();
-    painter->setRenderHints(QPainter::Antialiasing);
-    painter->setPen(QPen(Qt::black, 3));
-    QPainterPath path;
-    qreal pathXStart = 0;
-    qreal pathYStart = 0;
-    qreal pathXEnd = 0;
-    qreal pathYEnd = 0;
-    if (d->_isCreateWithItem)
+    if (option->levelOfDetailFromTransform(painter->worldTransform()) < ElaGraphicsLineItemPrivate::_lodSimplifyThreshold)
     {
-        pathXStart = d->_pStartItem->x();
-        pathYStart = d->_pStartItem->y();
-        pathXEnd = d->_pEndItem->x();
-        pathYEnd = d->_pEndItem->y();
+        // 远景 不抗锯齿的单像素直线代替曲线
+        QPainterPath linkPath = path();
+        painter->setPen(QPen(pen().color(), 0));
+        painter->drawLine(linkPath.elementAt(0), linkPath.currentPosition());
     }
     else
     {
-        pathXStart = d->_pStartPoint.x();
-        pathYStart = d->_pStartPoint.y();
-        pathXEnd = d->_pEndPoint.x();
-        pathYEnd = d->_pEndPoint.y();
+        painter->setRenderHints(QPainter::Antialiasing);
+        painter->setPen(pen());
+        painter->drawPath(path());
     }
-    path.moveTo(pathXStart, pathYStart); // 设置起始点
-    path.cubicTo((pathXStart + pathXEnd) / 2, pathYStart, (pathXStart + pathXEnd) / 2, pathYEnd, pathXEnd, pathYEnd);
-    setPath(path);
-    painter->drawPath(path);
     painter->restore();
 }
 
 QRectF ElaGraphicsLineItem::boundingRect() const
 {
-    if (!QGraphicsPathItem::boundingRect().isValid())
+    if (!QGraphicsPathItem::boundingRect().isValid() && scene())
     {
         return scene()->sceneRect();
     }
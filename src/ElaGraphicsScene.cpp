@@ -5,12 +5,16 @@
 #include <QGraphicsSceneMouseEvent>
 #include <QGraphicsView>
 #include <QKeyEvent>
+#include <QSet>
+#include <QThread>
+#include <QTimer>
 
 #include "ElaGraphicsItem.h"
 #include "ElaGraphicsLineItem.h"
 #include "private/ElaGraphicsScenePrivate.h"
 Q_PROPERTY_CREATE_Q_CPP(ElaGraphicsScene, bool, IsCheckLinkPort)
 Q_PROPERTY_CREATE_Q_CPP(ElaGraphicsScene, QString, SerializePath)
+Q_PROPERTY_CREATE_Q_CPP(ElaGraphicsScene, int, DeserializeBatchMsec)
 ElaGraphicsScene::ElaGraphicsScene(QObject* parent)
     : QGraphicsScene(parent), d_ptr(new ElaGraphicsScenePrivate())
 {
@@ -20,10 +24,19 @@ ElaGraphicsScene::ElaGraphicsScene(QObject* parent)
     d->_pIsCheckLinkPort = false;
     d->_sceneMode = ElaGraphicsSceneType::SceneMode::Default;
     d->_pSerializePath = "./scene.bin";
+    d->_pDeserializeBatchMsec = 8;
 }
 
 ElaGraphicsScene::~ElaGraphicsScene()
 {
+    Q_D(ElaGraphicsScene);
+    if (d->_loaderThread)
+    {
+        d->_loader->cancelLoad();
+        d->_loaderThread->quit();
+        d->_loaderThread->wait();
+        delete d->_loader;
+    }
 }
 
 void ElaGraphicsScene::addItem(ElaGraphicsItem* item)
@@ -33,12 +46,9 @@ void ElaGraphicsScene::addItem(ElaGraphicsItem* item)
     {
         return;
     }
-    for (const auto& pair : d->_items.toStdMap())
+    if (d->_items.value(item->getItemUID()) == item)
     {
-        if (pair.second == item)
-        {
-            return;
-        }
+        return;
     }
     item->setParent(this);
     item->setZValue(d->_currentZ);
@@ -49,7 +59,11 @@ void ElaGraphicsScene::addItem(ElaGraphicsItem* item)
     item->setPos(sceneRect().width() / 2, sceneRect().height() / 2);
     QGraphicsScene::addItem(item);
     d->_currentZ++;
-    d->_items.insert(item->getItemUID(), item);
+    d->_insertItem(item->getItemUID(), item);
+    if (d->_itemIndexMode == ElaGraphicsSceneType::GridIndex && !d->_isBatchUpdating)
+    {
+        d->_gridIndex.insertItem(item);
+    }
 }
 
 void ElaGraphicsScene::removeItem(ElaGraphicsItem* item)
@@ -59,11 +73,15 @@ void ElaGraphicsScene::removeItem(ElaGraphicsItem* item)
     {
         return;
     }
-    d->_items.remove(d->_items.key(item));
+    d->_removeItem(item);
+    d->_gridIndex.removeItem(item);
     removeItemLink(item);
     QGraphicsScene::removeItem(item);
     delete item;
-    update();
+    if (!d->_isBatchUpdating)
+    {
+        update();
+    }
 }
 
 void ElaGraphicsScene::removeSelectedItems()
@@ -73,24 +91,98 @@ void ElaGraphicsScene::removeSelectedItems()
     {
         return;
     }
-    for (auto item : selectedItemList)
+    removeItems(selectedItemList);
+}
+
+void ElaGraphicsScene::clear()
+{
+    Q_D(ElaGraphicsScene);
+    d->_cancelDeserialize();
+    for (auto lineItem : d->_lineItemMap)
     {
-        removeItem(item);
+        QGraphicsScene::removeItem(lineItem);
+        delete lineItem;
+    }
+    d->_lineItemMap.clear();
+    d->_lineItemOrderHash.clear();
+    d->_itemLinkHash.clear();
+    d->_itemLinkPortHash.clear();
+    d->_gridIndex.clear();
+    for (auto item : d->_getItemList())
+    {
+        delete item;
     }
+    d->_clearItems();
+    update();
 }
 
-void ElaGraphicsScene::clear()
+void ElaGraphicsScene::addItems(const QList<ElaGraphicsItem*>& itemList)
+{
+    Q_D(ElaGraphicsScene);
+    if (itemList.isEmpty())
+    {
+        return;
+    }
+    d->_reserveItems(itemList.count());
+    d->_isBatchUpdating = true;
+    for (auto item : itemList)
+    {
+        addItem(item);
+    }
+    d->_isBatchUpdating = false;
+    if (d->_itemIndexMode == ElaGraphicsSceneType::GridIndex)
+    {
+        for (auto item : itemList)
+        {
+            d->_gridIndex.insertItem(item);
+        }
+    }
+}
+
+void ElaGraphicsScene::removeItems(const QList<ElaGraphicsItem*>& itemList)
 {
     Q_D(ElaGraphicsScene);
-    d->_itemsLink.clear();
-    for (const auto& pair : d->_items.toStdMap())
+    if (itemList.isEmpty())
     {
-        delete pair.second;
+        return;
     }
-    d->_items.clear();
+    d->_isBatchUpdating = true;
+    for (auto item : itemList)
+    {
+        removeItem(item);
+    }
+    d->_isBatchUpdating = false;
     update();
 }
 
+void ElaGraphicsScene::setItemIndexMode(ElaGraphicsSceneType::ItemIndexMode mode)
+{
+    Q_D(ElaGraphicsScene);
+    if (d->_itemIndexMode == mode)
+    {
+        return;
+    }
+    d->_itemIndexMode = mode;
+    setItemIndexMethod(mode == ElaGraphicsSceneType::BspTreeIndex ? QGraphicsScene::BspTreeIndex : QGraphicsScene::NoIndex);
+    d->_rebuildItemIndex();
+}
+
+ElaGraphicsSceneType::ItemIndexMode ElaGraphicsScene::getItemIndexMode() const
+{
+    return d_ptr->_itemIndexMode;
+}
+
+void ElaGraphicsScene::setGridIndexCellSize(int cellSize)
+{
+    Q_D(ElaGraphicsScene);
+    d->_gridIndex.setCellSize(cellSize);
+}
+
+int ElaGraphicsScene::getGridIndexCellSize() const
+{
+    return d_ptr->_gridIndex.getCellSize();
+}
+
 QList<ElaGraphicsItem*> ElaGraphicsScene::createAndAddItem(int width, int height, int count)
 {
     if (count <= 0)
@@ -98,14 +190,15 @@ QList<ElaGraphicsItem*> ElaGraphicsScene::createAndAddItem(int width, int height
         return QList<ElaGraphicsItem*>();
     }
     QList<ElaGraphicsItem*> createItemList;
+    createItemList.reserve(count);
     for (int i = 0; i < count; i++)
     {
         ElaGraphicsItem* item = new ElaGraphicsItem();
         item->setWidth(width);
         item->setHeight(height);
         createItemList.append(item);
-        addItem(item);
     }
+    addItems(createItemList);
     return createItemList;
 }
 
@@ -127,67 +220,37 @@ QList<ElaGraphicsItem*> ElaGraphicsScene::getSelectedElaItems() const
 QList<ElaGraphicsItem*> ElaGraphicsScene::getElaItems()
 {
     Q_D(ElaGraphicsScene);
-    return d->_items.values();
+    return d->_getItemList();
 }
 
 QList<ElaGraphicsItem*> ElaGraphicsScene::getElaItems(QPoint pos)
 {
-    QList<QGraphicsItem*> itemList = items(pos);
-    QList<ElaGraphicsItem*> elaItemList;
-    for (auto item : itemList)
-    {
-        ElaGraphicsItem* elaItem = dynamic_cast<ElaGraphicsItem*>(item);
-        if (elaItem)
-        {
-            elaItemList.append(elaItem);
-        }
-    }
-    return elaItemList;
+    return getElaItems(QPointF(pos));
 }
 
 QList<ElaGraphicsItem*> ElaGraphicsScene::getElaItems(QPointF pos)
 {
-    QList<QGraphicsItem*> itemList = items(pos);
-    QList<ElaGraphicsItem*> elaItemList;
-    for (auto item : itemList)
+    Q_D(ElaGraphicsScene);
+    if (d->_itemIndexMode == ElaGraphicsSceneType::GridIndex)
     {
-        ElaGraphicsItem* elaItem = dynamic_cast<ElaGraphicsItem*>(item);
-        if (elaItem)
-        {
-            elaItemList.append(elaItem);
-        }
+        return d->_gridIndex.getItems(pos);
     }
-    return elaItemList;
+    return d->_filterElaItems(items(pos));
 }
 
 QList<ElaGraphicsItem*> ElaGraphicsScene::getElaItems(QRect rect)
 {
-    QList<QGraphicsItem*> itemList = items(rect);
-    QList<ElaGraphicsItem*> elaItemList;
-    for (auto item : itemList)
-    {
-        ElaGraphicsItem* elaItem = dynamic_cast<ElaGraphicsItem*>(item);
-        if (elaItem)
-        {
-            elaItemList.append(elaItem);
-        }
-    }
-    return elaItemList;
+    return getElaItems(QRectF(rect));
 }
 
 QList<ElaGraphicsItem*> ElaGraphicsScene::getElaItems(QRectF rect)
 {
-    QList<QGraphicsItem*> itemList = items(rect);
-    QList<ElaGraphicsItem*> elaItemList;
-    for (auto item : itemList)
+    Q_D(ElaGraphicsScene);
+    if (d->_itemIndexMode == ElaGraphicsSceneType::GridIndex)
     {
-        ElaGraphicsItem* elaItem = dynamic_cast<ElaGraphicsItem*>(item);
-        if (elaItem)
-        {
-            elaItemList.append(elaItem);
-        }
+        return d->_gridIndex.getItems(rect);
     }
-    return elaItemList;
+    return d->_filterElaItems(items(rect));
 }
 
 void ElaGraphicsScene::setSceneMode(ElaGraphicsSceneType::SceneMode mode)
@@ -212,16 +275,15 @@ ElaGraphicsSceneType::SceneMode ElaGraphicsScene::getSceneMode() const
 void ElaGraphicsScene::selectAllItems()
 {
     Q_D(ElaGraphicsScene);
-    for (const auto& pair : d->_items.toStdMap())
+    for (auto item : d->_getItemList())
     {
-        ElaGraphicsItem* item = pair.second;
         item->setSelected(true);
     }
 }
 
 QList<QVariantMap> ElaGraphicsScene::getItemLinkList() const
 {
-    return d_ptr->_itemsLink;
+    return d_ptr->_getItemLinkList();
 }
 
 bool ElaGraphicsScene::addItemLink(ElaGraphicsItem* item1, ElaGraphicsItem* item2, int port1, int port2)
@@ -243,13 +305,7 @@ bool ElaGraphicsScene::addItemLink(ElaGraphicsItem* item1, ElaGraphicsItem* item
             return false;
         }
     }
-    QVariantMap linkObject;
-    linkObject.insert(item1->getItemUID(), port1);
-    linkObject.insert(item2->getItemUID(), port2);
-    d->_itemsLink.append(linkObject);
-    ElaGraphicsLineItem* lineItem = new ElaGraphicsLineItem(item1, item2, port1, port2);
-    QGraphicsScene::addItem(lineItem);
-    d->_lineItemsList.append(lineItem);
+    d->_attachLink(new ElaGraphicsLineItem(item1, item2, port1, port2));
     update();
     return true;
 }
@@ -266,32 +322,21 @@ bool ElaGraphicsScene::removeItemLink(ElaGraphicsItem* item1)
         item1->setLinkPortState(false);
     }
     // 处理与该Item有关的连接
-    foreach (auto& link, d->_itemsLink)
+    QVector<ElaGraphicsLineItem*> lineItemVector = d->_getItemLinks(item1);
+    for (auto lineItem : lineItemVector)
     {
-        if (link.contains(item1->getItemUID()))
+        if (d->_pIsCheckLinkPort)
         {
-            if (d->_pIsCheckLinkPort)
-            {
-                // 解除otherItem端口占用
-                QStringList keys = link.keys();
-                keys.removeOne(item1->getItemUID());
-                ElaGraphicsItem* otherItem = d->_items.value(keys.at(0));
-                otherItem->setLinkPortState(false, link.value(keys.at(0)).toInt());
-            }
-            d->_itemsLink.removeOne(link);
+            // 解除otherItem端口占用
+            ElaGraphicsItem* otherItem = d->_getOtherLinkItem(lineItem, item1);
+            otherItem->setLinkPortState(false, d->_getLinkItemPort(lineItem, otherItem));
         }
+        d->_detachLink(lineItem);
     }
-    // 处理连接图元
-    foreach (auto lineItem, d->_lineItemsList)
+    if (!d->_isBatchUpdating)
     {
-        if (lineItem->isTargetLink(item1))
-        {
-            d->_lineItemsList.removeOne(lineItem);
-            QGraphicsScene::removeItem(lineItem);
-            delete lineItem;
-        }
+        update();
     }
-    update();
     return true;
 }
 
@@ -302,51 +347,116 @@ bool ElaGraphicsScene::removeItemLink(ElaGraphicsItem* item1, ElaGraphicsItem* i
     {
         return false;
     }
-    bool isLinkExist = false;
-    foreach (auto& link, d->_itemsLink)
+    QVector<ElaGraphicsLineItem*> lineItemVector = d->_itemLinkHash.value(qMakePair(item1, port1));
+    for (auto lineItem : lineItemVector)
     {
-        QVariant portVariant1 = link.value(item1->getItemUID());
-        QVariant portVariant2 = link.value(item2->getItemUID());
-        if (portVariant1.isValid() && portVariant2.isValid() && portVariant1.toUInt() == port1 && portVariant2.toUInt() == port2)
+        if (d->_getOtherLinkItem(lineItem, item1) == item2 && d->_getLinkItemPort(lineItem, item2) == port2)
         {
-            d->_itemsLink.removeOne(link);
-            // 这里处理连线图元
-            isLinkExist = true;
-            break;
+            d->_detachLink(lineItem);
+            if (d->_pIsCheckLinkPort)
+            {
+                item1->setLinkPortState(false, port1);
+                item2->setLinkPortState(false, port2);
+            }
+            update();
+            return true;
         }
     }
-    foreach (auto lineItem, d->_lineItemsList)
+    return false;
+}
+
+int ElaGraphicsScene::getItemLinkCount(ElaGraphicsItem* item) const
+{
+    return d_ptr->_getItemLinkCount(item);
+}
+
+QList<ElaGraphicsItem*> ElaGraphicsScene::getLinkedItems(ElaGraphicsItem* item, int port) const
+{
+    QList<ElaGraphicsItem*> linkedItemList;
+    QSet<ElaGraphicsItem*> linkedItemSet;
+    QVector<ElaGraphicsLineItem*> lineItemVector = port >= 0 ? d_ptr->_itemLinkHash.value(qMakePair(item, port)) : d_ptr->_getItemLinks(item);
+    for (auto lineItem : lineItemVector)
     {
-        if (lineItem->isTargetLink(item1, item2, port1, port2))
+        ElaGraphicsItem* otherItem = d_ptr->_getOtherLinkItem(lineItem, item);
+        if (!linkedItemSet.contains(otherItem))
         {
-            d->_lineItemsList.removeOne(lineItem);
-            QGraphicsScene::removeItem(lineItem);
-            delete lineItem;
-            break;
+            linkedItemSet.insert(otherItem);
+            linkedItemList.append(otherItem);
         }
     }
-    if (isLinkExist)
+    return linkedItemList;
+}
+
+bool ElaGraphicsScene::isItemLinked(ElaGraphicsItem* item1, ElaGraphicsItem* item2) const
+{
+    // 从度数较小的一端查找
+    ElaGraphicsItem* sourceItem = d_ptr->_getItemLinkCount(item1) <= d_ptr->_getItemLinkCount(item2) ? item1 : item2;
+    ElaGraphicsItem* targetItem = sourceItem == item1 ? item2 : item1;
+    for (auto port : d_ptr->_itemLinkPortHash.value(sourceItem))
     {
-        if (d->_pIsCheckLinkPort)
+        for (auto lineItem : d_ptr->_itemLinkHash.value(qMakePair(sourceItem, port)))
         {
-            item1->setLinkPortState(false, port1);
-            item2->setLinkPortState(false, port2);
+            if (d_ptr->_getOtherLinkItem(lineItem, sourceItem) == targetItem)
+            {
+                return true;
+            }
         }
-        update();
-        return true;
     }
-    else
+    return false;
+}
+
+QList<ElaGraphicsItem*> ElaGraphicsScene::getConnectedItems(ElaGraphicsItem* item) const
+{
+    QList<ElaGraphicsItem*> connectedItemList;
+    if (!item || !d_ptr->_items.contains(item->getItemUID()))
     {
-        return false;
+        return connectedItemList;
+    }
+    // 广度优先遍历
+    QSet<ElaGraphicsItem*> visitedSet;
+    visitedSet.insert(item);
+    connectedItemList.append(item);
+    for (int i = 0; i < connectedItemList.count(); i++)
+    {
+        ElaGraphicsItem* currentItem = connectedItemList[i];
+        for (auto lineItem : d_ptr->_getItemLinks(currentItem))
+        {
+            ElaGraphicsItem* otherItem = d_ptr->_getOtherLinkItem(lineItem, currentItem);
+            if (!visitedSet.contains(otherItem))
+            {
+                visitedSet.insert(otherItem);
+                connectedItemList.append(otherItem);
+            }
+        }
+    }
+    return connectedItemList;
+}
+
+QList<QList<ElaGraphicsItem*>> ElaGraphicsScene::getConnectedComponents() const
+{
+    QList<QList<ElaGraphicsItem*>> componentList;
+    QSet<ElaGraphicsItem*> visitedSet;
+    for (auto item : d_ptr->_getItemList())
+    {
+        if (visitedSet.contains(item))
+        {
+            continue;
+        }
+        QList<ElaGraphicsItem*> connectedItemList = getConnectedItems(item);
+        for (auto connectedItem : connectedItemList)
+        {
+            visitedSet.insert(connectedItem);
+        }
+        componentList.append(connectedItemList);
     }
+    return componentList;
 }
 
 QVector<QVariantMap> ElaGraphicsScene::getItemsDataRoute() const
 {
     QVector<QVariantMap> dataRouteVector;
-    for (const auto& pair : d_ptr->_items.toStdMap())
+    for (auto item : d_ptr->_getItemList())
     {
-        ElaGraphicsItem* item = pair.second;
         dataRouteVector.append(item->getDataRoutes());
     }
     return dataRouteVector;
@@ -370,6 +480,7 @@ void ElaGraphicsScene::serialize()
 void ElaGraphicsScene::deserialize()
 {
     Q_D(ElaGraphicsScene);
+    d->_cancelDeserialize();
     QFile file(d->_pSerializePath);
     if (!file.open(QIODevice::ReadOnly))
     {
@@ -382,6 +493,38 @@ void ElaGraphicsScene::deserialize()
     update();
 }
 
+void ElaGraphicsScene::deserializeAsync()
+{
+    Q_D(ElaGraphicsScene);
+    d->_cancelDeserialize();
+    if (!d->_loaderThread)
+    {
+        d->_loaderThread = new QThread(this);
+        d->_loader = new ElaGraphicsSceneLoader();
+        d->_loader->moveToThread(d->_loaderThread);
+        connect(d, &ElaGraphicsScenePrivate::loadScene, d->_loader, &ElaGraphicsSceneLoader::onLoadScene);
+        connect(d->_loader, &ElaGraphicsSceneLoader::loadSceneFinished, d, &ElaGraphicsScenePrivate::onLoadSceneFinished);
+        d->_loadTimer = new QTimer(d);
+        d->_loadTimer->setInterval(0);
+        connect(d->_loadTimer, &QTimer::timeout, d, &ElaGraphicsScenePrivate::onLoadTimerTimeout);
+        d->_loaderThread->start();
+    }
+    d->_isDeserializing = true;
+    d->_loadRequestID = d->_loader->requestLoad();
+    Q_EMIT d->loadScene(d->_loadRequestID, d->_pSerializePath);
+}
+
+void ElaGraphicsScene::cancelDeserialize()
+{
+    Q_D(ElaGraphicsScene);
+    d->_cancelDeserialize();
+}
+
+bool ElaGraphicsScene::getIsDeserializing() const
+{
+    return d_ptr->_isDeserializing;
+}
+
 void ElaGraphicsScene::focusOutEvent(QFocusEvent* event)
 {
     Q_D(ElaGraphicsScene);
@@ -480,12 +623,6 @@ void ElaGraphicsScene::mouseReleaseEvent(QGraphicsSceneMouseEvent* event)
                 }
                 else
                 {
-                    QVariantMap linkObject;
-                    for (auto item : selectedItemList)
-                    {
-                        linkObject.insert(item->getItemUID(), 0);
-                    }
-                    d->_itemsLink.append(linkObject);
                     QGraphicsScene::mouseReleaseEvent(event);
                     d->_removeLinkLineItem();
                     addItemLink(selectedItemList.at(0), selectedItemList.at(1));
@@ -528,17 +665,6 @@ void ElaGraphicsScene::mouseMoveEvent(QGraphicsSceneMouseEvent* event)
             if (d->_linkLineItem)
             {
                 d->_linkLineItem->setEndPoint(event->scenePos());
-                d->_linkLineItem->update();
-            }
-        }
-    }
-    else
-    {
-        if (d->_isLeftButtonPress)
-        {
-            for (auto lineItem : d->_lineItemsList)
-            {
-                lineItem->update();
             }
         }
     }
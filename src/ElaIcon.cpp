@@ -1,10 +1,16 @@
 #include "ElaIcon.h"
 
-#include <QPainter>
 #include <QPixmap>
+
+#include "ElaIconPrivate.h"
 Q_SINGLETON_CREATE_CPP(ElaIcon)
 ElaIcon::ElaIcon()
+    : d_ptr(new ElaIconPrivate())
 {
+    Q_D(ElaIcon);
+    d->q_ptr = this;
+    // 单位KB
+    d->_iconCache.setMaxCost(16 * 1024);
 }
 
 ElaIcon::~ElaIcon()
@@ -13,100 +19,69 @@ ElaIcon::~ElaIcon()
 
 QIcon ElaIcon::getElaIcon(ElaIconType::IconName awesome)
 {
-    QFont iconFont = QFont("ElaAwesome");
-    QPixmap pix(30, 30);
-    pix.fill(Qt::transparent);
-    QPainter painter;
-    painter.begin(&pix);
-    painter.setRenderHints(QPainter::Antialiasing | QPainter::TextAntialiasing | QPainter::SmoothPixmapTransform);
-    // painter.setPen(QColor("#1570A5"));
-    // painter.setBrush(QColor("#1570A5"));
-    iconFont.setPixelSize(25);
-    painter.setFont(iconFont);
-    painter.drawText(pix.rect(), Qt::AlignCenter, QChar((unsigned short)awesome));
-    painter.end();
-    return QIcon(pix);
+    return getElaIcon(awesome, 25, 30, 30, Qt::black);
 }
 
 QIcon ElaIcon::getElaIcon(ElaIconType::IconName awesome, QColor iconColor)
 {
-    QFont iconFont = QFont("ElaAwesome");
-    QPixmap pix(30, 30);
-    pix.fill(Qt::transparent);
-    QPainter painter;
-    painter.begin(&pix);
-    painter.setRenderHints(QPainter::Antialiasing | QPainter::TextAntialiasing | QPainter::SmoothPixmapTransform);
-    painter.setPen(iconColor);
-    // painter.setBrush(QColor("#1570A5"));
-    iconFont.setPixelSize(25);
-    painter.setFont(iconFont);
-    painter.drawText(pix.rect(), Qt::AlignCenter, QChar((unsigned short)awesome));
-    painter.end();
-    return QIcon(pix);
+    return getElaIcon(awesome, 25, 30, 30, iconColor);
 }
 
 QIcon ElaIcon::getElaIcon(ElaIconType::IconName awesome, int pixelSize)
 {
-    QFont iconFont = QFont("ElaAwesome");
-    QPixmap pix(pixelSize, pixelSize);
-    pix.fill(Qt::transparent);
-    QPainter painter;
-    painter.begin(&pix);
-    painter.setRenderHints(QPainter::Antialiasing | QPainter::TextAntialiasing | QPainter::SmoothPixmapTransform);
-    iconFont.setPixelSize(pixelSize);
-    painter.setFont(iconFont);
-    // 画图形字体
-    painter.drawText(pix.rect(), Qt::AlignCenter, QChar((unsigned short)awesome));
-    painter.end();
-    return QIcon(pix);
+    return getElaIcon(awesome, pixelSize, pixelSize, pixelSize, Qt::black);
 }
 
 QIcon ElaIcon::getElaIcon(ElaIconType::IconName awesome, int pixelSize, QColor iconColor)
 {
-    QFont iconFont = QFont("ElaAwesome");
-    QPixmap pix(pixelSize, pixelSize);
-    pix.fill(Qt::transparent);
-    QPainter painter;
-    painter.begin(&pix);
-    painter.setRenderHints(QPainter::Antialiasing | QPainter::TextAntialiasing | QPainter::SmoothPixmapTransform);
-    painter.setPen(iconColor);
-    iconFont.setPixelSize(pixelSize);
-    painter.setFont(iconFont);
-    // 画图形字体
-    painter.drawText(pix.rect(), Qt::AlignCenter, QChar((unsigned short)awesome));
-    painter.end();
-    return QIcon(pix);
+    return getElaIcon(awesome, pixelSize, pixelSize, pixelSize, iconColor);
 }
 
 QIcon ElaIcon::getElaIcon(ElaIconType::IconName awesome, int pixelSize, int fixedWidth, int fixedHeight)
 {
-    QFont iconFont = QFont("ElaAwesome");
-    QPixmap pix(fixedWidth, fixedHeight);
-    pix.fill(Qt::transparent);
-    QPainter painter;
-    painter.begin(&pix);
-    painter.setRenderHints(QPainter::Antialiasing | QPainter::TextAntialiasing | QPainter::SmoothPixmapTransform);
-    iconFont.setPixelSize(pixelSize);
-    painter.setFont(iconFont);
-    // 画图形字体
-    painter.drawText(pix.rect(), Qt::AlignCenter, QChar((unsigned short)awesome));
-    painter.end();
-    return QIcon(pix);
+    return getElaIcon(awesome, pixelSize, fixedWidth, fixedHeight, Qt::black);
 }
 
 QIcon ElaIcon::getElaIcon(ElaIconType::IconName awesome, int pixelSize, int fixedWidth, int fixedHeight, QColor iconColor)
 {
-    QFont iconFont = QFont("ElaAwesome");
-    QPixmap pix(fixedWidth, fixedHeight);
-    pix.fill(Qt::transparent);
-    QPainter painter;
-    painter.begin(&pix);
-    painter.setRenderHints(QPainter::Antialiasing | QPainter::TextAntialiasing | QPainter::SmoothPixmapTransform);
-    painter.setPen(iconColor);
-    iconFont.setPixelSize(pixelSize);
-    painter.setFont(iconFont);
-    // 画图形字体
-    painter.drawText(pix.rect(), Qt::AlignCenter, QChar((unsigned short)awesome));
-    painter.end();
-    return QIcon(pix);
+    Q_D(ElaIcon);
+    return d->_getIconCacheData(awesome, pixelSize, fixedWidth, fixedHeight, iconColor, 0).icon;
+}
+
+QPixmap ElaIcon::getElaIconPixmap(ElaIconType::IconName awesome, int pixelSize, int fixedWidth, int fixedHeight, QColor iconColor, qreal devicePixelRatio)
+{
+    Q_D(ElaIcon);
+    return d->_getIconCacheData(awesome, pixelSize, fixedWidth, fixedHeight, iconColor, devicePixelRatio).iconPixmap;
+}
+
+void ElaIcon::setMaxCacheCost(int maxCacheCost)
+{
+    Q_D(ElaIcon);
+    d->_iconCache.setMaxCost(maxCacheCost);
+}
+
+int ElaIcon::getMaxCacheCost() const
+{
+    return d_ptr->_iconCache.maxCost();
+}
+
+int ElaIcon::getCacheCount() const
+{
+    return d_ptr->_iconCache.count();
+}
+
+int ElaIcon::getCacheHitCount() const
+{
+    return d_ptr->_cacheHitCount;
+}
+
+int ElaIcon::getCacheMissCount() const
+{
+    return d_ptr->_cacheMissCount;
+}
+
+void ElaIcon::clearCache()
+{
+    Q_D(ElaIcon);
+    d->_iconCache.clear();
 }
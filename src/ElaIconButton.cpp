@@ -6,6 +6,7 @@
 #include <QPainterPath>
 #include <QPropertyAnimation>
 
+#include "ElaApplication.h"
 #include "ElaTheme.h"
 #include "private/ElaIconButtonPrivate.h"
 Q_PROPERTY_CREATE_Q_CPP(ElaIconButton, int, BorderRadius)
@@ -153,7 +154,7 @@ bool ElaIconButton::event(QEvent* event)
             connect(alphaAnimation, &QPropertyAnimation::finished, this, [=]() {
                 d->_isAlphaAnimationFinished = true;
             });
-            alphaAnimation->setDuration(175);
+            alphaAnimation->setDuration(eApp->getAnimationDuration(175, true));
             alphaAnimation->setStartValue(d->_pHoverAlpha);
             alphaAnimation->setEndValue(d->_themeMode == ElaThemeType::Light ? d->_pLightHoverColor.alpha() : d->_pDarkHoverColor.alpha());
             alphaAnimation->start(QAbstractAnimation::DeleteWhenStopped);
@@ -172,7 +173,7 @@ bool ElaIconButton::event(QEvent* event)
             connect(alphaAnimation, &QPropertyAnimation::finished, this, [=]() {
                 d->_isAlphaAnimationFinished = true;
             });
-            alphaAnimation->setDuration(175);
+            alphaAnimation->setDuration(eApp->getAnimationDuration(175, true));
             alphaAnimation->setStartValue(d->_pHoverAlpha);
             alphaAnimation->setEndValue(0);
             alphaAnimation->start(QAbstractAnimation::DeleteWhenStopped);
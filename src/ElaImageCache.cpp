@@ -0,0 +1,141 @@
+#include "ElaImageCache.h"
+
+#include <QMutexLocker>
+#include <QPixmapCache>
+
+#include "ElaImageCachePrivate.h"
+Q_SINGLETON_CREATE_CPP(ElaImageCache)
+ElaImageCache::ElaImageCache(QObject* parent)
+    : QObject{parent}, d_ptr(new ElaImageCachePrivate())
+{
+    Q_D(ElaImageCache);
+    d->q_ptr = this;
+    d->_imageCache.setMaxCost(64 * 1024);
+}
+
+ElaImageCache::~ElaImageCache()
+{
+}
+
+QImage ElaImageCache::getImage(const QString& imagePath, QSize imageSize)
+{
+    Q_D(ElaImageCache);
+    QString cacheKey = d->_getCacheKey(imagePath, imageSize);
+    {
+        QMutexLocker locker(&d->_cacheMutex);
+        QImage* cacheImage = d->_imageCache.object(cacheKey);
+        if (cacheImage)
+        {
+            d->_cacheHitCount++;
+            return *cacheImage;
+        }
+        d->_cacheMissCount++;
+    }
+    // 解码在锁外进行 避免阻塞其他线程的命中查询
+    QImage image;
+    if (imageSize.isValid())
+    {
+        image = getImage(imagePath).scaled(imageSize, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+    }
+    else
+    {
+        image = QImage(imagePath);
+    }
+    if (image.isNull())
+    {
+        return image;
+    }
+    QMutexLocker locker(&d->_cacheMutex);
+    d->_imageCache.insert(cacheKey, new QImage(image), qMax(1, static_cast<int>(image.sizeInBytes() / 1024)));
+    return image;
+}
+
+QPixmap ElaImageCache::getPixmap(const QString& imagePath, QSize pixmapSize, qreal devicePixelRatio)
+{
+    Q_D(ElaImageCache);
+    QSize deviceSize = pixmapSize.isValid() ? pixmapSize * devicePixelRatio : QSize();
+    QString cacheKey = QString("ElaImageCache:%1@%2").arg(d->_getCacheKey(imagePath, deviceSize)).arg(devicePixelRatio);
+    QPixmap pixmap;
+    if (QPixmapCache::find(cacheKey, &pixmap))
+    {
+        return pixmap;
+    }
+    pixmap = QPixmap::fromImage(getImage(imagePath, deviceSize));
+    pixmap.setDevicePixelRatio(devicePixelRatio);
+    if (!pixmap.isNull())
+    {
+        QPixmapCache::insert(cacheKey, pixmap);
+        d->_pixmapKeySet.insert(cacheKey);
+    }
+    return pixmap;
+}
+
+void ElaImageCache::removeImage(const QString& imagePath)
+{
+    Q_D(ElaImageCache);
+    {
+        QMutexLocker locker(&d->_cacheMutex);
+        for (const auto& cacheKey : d->_imageCache.keys())
+        {
+            if (cacheKey == imagePath || cacheKey.startsWith(imagePath + "@"))
+            {
+                d->_imageCache.remove(cacheKey);
+            }
+        }
+    }
+    QString pixmapKeyPrefix = QString("ElaImageCache:%1@").arg(imagePath);
+    for (auto it = d->_pixmapKeySet.begin(); it != d->_pixmapKeySet.end();)
+    {
+        if (it->startsWith(pixmapKeyPrefix))
+        {
+            QPixmapCache::remove(*it);
+            it = d->_pixmapKeySet.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void ElaImageCache::clear()
+{
+    Q_D(ElaImageCache);
+    {
+        QMutexLocker locker(&d->_cacheMutex);
+        d->_imageCache.clear();
+    }
+    for (const auto& cacheKey : d->_pixmapKeySet)
+    {
+        QPixmapCache::remove(cacheKey);
+    }
+    d->_pixmapKeySet.clear();
+}
+
+void ElaImageCache::setMaxCacheCost(int maxCacheCost)
+{
+    Q_D(ElaImageCache);
+    QMutexLocker locker(&d->_cacheMutex);
+    d->_imageCache.setMaxCost(maxCacheCost);
+}
+
+int ElaImageCache::getMaxCacheCost() const
+{
+    Q_D(const ElaImageCache);
+    QMutexLocker locker(&d->_cacheMutex);
+    return d->_imageCache.maxCost();
+}
+
+int ElaImageCache::getCacheHitCount() const
+{
+    Q_D(const ElaImageCache);
+    QMutexLocker locker(&d->_cacheMutex);
+    return d->_cacheHitCount;
+}
+
+int ElaImageCache::getCacheMissCount() const
+{
+    Q_D(const ElaImageCache);
+    QMutexLocker locker(&d->_cacheMutex);
+    return d->_cacheMissCount;
+}
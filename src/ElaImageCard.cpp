@@ -2,8 +2,8 @@
 
 #include <QGraphicsDropShadowEffect>
 #include <QPainter>
-#include <QPainterPath>
 
+#include "ElaCardPainter.h"
 #include "ElaImageCardPrivate.h"
 #include "ElaTheme.h"
 
@@ -34,31 +34,10 @@ void ElaImageCard::paintEvent(QPaintEvent* event)
 {
     Q_D(ElaImageCard);
     QPainter painter(this);
-    painter.save();
-    painter.setPen(Qt::NoPen);
-    painter.setRenderHints(QPainter::SmoothPixmapTransform | QPainter::Antialiasing);
-    QPainterPath path;
-    path.addRoundedRect(rect(), d->_pBorderRadius, d->_pBorderRadius);
-    painter.setClipPath(path);
-    // 图片绘制
-    if (d->_pIsPreserveAspectCrop)
-    {
-        qreal itemAspectRatio = (qreal)rect().width() / rect().height();
-        if (itemAspectRatio < d->_pMaximumAspectRatio)
-        {
-            itemAspectRatio = d->_pMaximumAspectRatio;
-            qreal cropHeight = d->_pCardImage.width() / itemAspectRatio;
-            painter.drawImage(QRect(0, 0, this->height() * d->_pMaximumAspectRatio, rect().height()), d->_pCardImage, QRectF(0, 0, d->_pCardImage.width(), cropHeight));
-        }
-        else
-        {
-            qreal cropHeight = d->_pCardImage.width() / itemAspectRatio;
-            painter.drawImage(rect(), d->_pCardImage, QRectF(0, 0, d->_pCardImage.width(), cropHeight));
-        }
-    }
-    else
-    {
-        painter.drawImage(rect(), d->_pCardImage);
-    }
-    painter.restore();
+    ElaCardPaintData paintData;
+    paintData.borderRadius = d->_pBorderRadius;
+    paintData.cardImage = d->_pCardImage;
+    paintData.isPreserveAspectCrop = d->_pIsPreserveAspectCrop;
+    paintData.maximumAspectRatio = d->_pMaximumAspectRatio;
+    ElaCardPainter::drawImageCard(&painter, rect(), paintData);
 }
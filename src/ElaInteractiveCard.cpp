@@ -1,8 +1,8 @@
 #include "ElaInteractiveCard.h"
 
 #include <QPainter>
-#include <QPainterPath>
 
+#include "ElaCardPainter.h"
 #include "ElaTheme.h"
 #include "private/ElaInteractiveCardPrivate.h"
 Q_PROPERTY_CREATE_Q_CPP(ElaInteractiveCard, int, BorderRadius)
@@ -48,46 +48,16 @@ void ElaInteractiveCard::paintEvent(QPaintEvent* event)
 {
     Q_D(ElaInteractiveCard);
     QPainter painter(this);
-    painter.save();
-    painter.setRenderHints(QPainter::SmoothPixmapTransform | QPainter::Antialiasing | QPainter::TextAntialiasing);
-    painter.setPen(Qt::NoPen);
-    painter.setBrush(underMouse() ? ElaThemeColor(d->_themeMode, BasicHoverAlpha) : Qt::transparent);
-    painter.drawRoundedRect(rect(), d->_pBorderRadius, d->_pBorderRadius);
-    // 图片绘制
-    if (!d->_pCardPixmap.isNull())
-    {
-        painter.save();
-        QPainterPath path;
-        if (d->_pCardPixMode == ElaCardPixType::PixMode::Ellipse)
-        {
-            path.addEllipse(QPointF(d->_pCardPixmapSize.width() / 2 + 10, height() / 2), d->_pCardPixmapSize.width() / 2, d->_pCardPixmapSize.height() / 2);
-            painter.setClipPath(path);
-            painter.drawPixmap(QRect(10, (height() - d->_pCardPixmapSize.height()) / 2, d->_pCardPixmapSize.width(), d->_pCardPixmapSize.height()), d->_pCardPixmap); // rect为绘制区域，image为要绘制的图片
-        }
-        else if (d->_pCardPixMode == ElaCardPixType::PixMode::Default)
-        {
-            painter.drawPixmap(10, (height() - d->_pCardPixmapSize.height()) / 2, d->_pCardPixmapSize.width(), d->_pCardPixmapSize.height(), d->_pCardPixmap);
-        }
-        else if (d->_pCardPixMode == ElaCardPixType::PixMode::RoundedRect)
-        {
-            path.addRoundedRect(QRectF(10, (height() - d->_pCardPixmapSize.height()) / 2, d->_pCardPixmapSize.width(), d->_pCardPixmapSize.height()), d->_pCardPixmapBorderRadius, d->_pCardPixmapBorderRadius);
-            painter.setClipPath(path);
-            painter.drawPixmap(10, (height() - d->_pCardPixmapSize.height()) / 2, d->_pCardPixmapSize.width(), d->_pCardPixmapSize.height(), d->_pCardPixmap);
-        }
-        painter.restore();
-    }
-    // 文字绘制
-    painter.setPen(ElaThemeColor(d->_themeMode, BasicText));
-    QFont font = this->font();
-    font.setWeight(QFont::Bold);
-    font.setPixelSize(d->_pTitlePixelSize);
-    painter.setFont(font);
-    int textStartX = d->_pCardPixmapSize.width() + 26;
-    int textWidth = width() - textStartX;
-    painter.drawText(QRect(textStartX, rect().y(), textWidth, height() / 2 - d->_pTitleSpacing), Qt::TextWordWrap | Qt::AlignBottom | Qt::AlignLeft, d->_pTitle);
-    font.setWeight(QFont::Normal);
-    font.setPixelSize(d->_pSubTitlePixelSize);
-    painter.setFont(font);
-    painter.drawText(QRect(textStartX, height() / 2 + d->_pTitleSpacing, textWidth, height() / 2 - d->_pTitleSpacing), Qt::TextWordWrap | Qt::AlignTop | Qt::AlignLeft, d->_pSubTitle);
-    painter.restore();
+    ElaCardPaintData paintData;
+    paintData.borderRadius = d->_pBorderRadius;
+    paintData.cardPixmap = d->_pCardPixmap;
+    paintData.cardPixmapSize = d->_pCardPixmapSize;
+    paintData.cardPixMode = d->_pCardPixMode;
+    paintData.cardPixmapBorderRadius = d->_pCardPixmapBorderRadius;
+    paintData.title = d->_pTitle;
+    paintData.subTitle = d->_pSubTitle;
+    paintData.titlePixelSize = d->_pTitlePixelSize;
+    paintData.subTitlePixelSize = d->_pSubTitlePixelSize;
+    paintData.titleSpacing = d->_pTitleSpacing;
+    ElaCardPainter::drawInteractiveCard(&painter, rect(), paintData, d->_themeMode, underMouse());
 }
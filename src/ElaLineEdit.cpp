@@ -7,6 +7,7 @@
 #include <QPainterPath>
 #include <QPropertyAnimation>
 
+#include "ElaApplication.h"
 #include "ElaEventBus.h"
 #include "ElaLineEditStyle.h"
 #include "ElaMenu.h"
@@ -71,7 +72,7 @@ void ElaLineEdit::focusInEvent(QFocusEvent* event)
         connect(markAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) {
             update();
         });
-        markAnimation->setDuration(300);
+        markAnimation->setDuration(eApp->getAnimationDuration(300));
         markAnimation->setEasingCurve(QEasingCurve::InOutSine);
         markAnimation->setStartValue(d->_pExpandMarkWidth);
         markAnimation->setEndValue(width() / 2 - d->_pBorderRadius / 2);
@@ -94,7 +95,7 @@ void ElaLineEdit::focusOutEvent(QFocusEvent* event)
         connect(markAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) {
             update();
         });
-        markAnimation->setDuration(300);
+        markAnimation->setDuration(eApp->getAnimationDuration(300));
         markAnimation->setEasingCurve(QEasingCurve::InOutSine);
         markAnimation->setStartValue(d->_pExpandMarkWidth);
         markAnimation->setEndValue(0);
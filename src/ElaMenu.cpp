@@ -9,6 +9,8 @@
 #include <QVBoxLayout>
 
 #include "DeveloperComponents/ElaMenuStyle.h"
+#include "ElaApplication.h"
+#include "ElaSnapshotCache.h"
 #include "private/ElaMenuPrivate.h"
 ElaMenu::ElaMenu(QWidget* parent)
     : QMenu(parent), d_ptr(new ElaMenuPrivate())
@@ -135,11 +137,18 @@ void ElaMenu::showEvent(QShowEvent* event)
     Q_D(ElaMenu);
     //消除阴影偏移
     move(this->pos().x() - 6, this->pos().y());
+    int animationDuration = eApp->getAnimationDuration(400);
+    if (animationDuration == 0)
+    {
+        d->_animationPix = QPixmap();
+        QMenu::showEvent(event);
+        return;
+    }
     if (!d->_animationPix.isNull())
     {
         d->_animationPix = QPixmap();
     }
-    d->_animationPix = this->grab(this->rect());
+    d->_animationPix = eSnapshotCache->getSnapshot(this);
     QPropertyAnimation* posAnimation = new QPropertyAnimation(d, "pAnimationImagePosY");
     connect(posAnimation, &QPropertyAnimation::finished, this, [=]() {
         d->_animationPix = QPixmap();
@@ -149,7 +158,7 @@ void ElaMenu::showEvent(QShowEvent* event)
         update();
     });
     posAnimation->setEasingCurve(QEasingCurve::OutCubic);
-    posAnimation->setDuration(400);
+    posAnimation->setDuration(animationDuration);
     int targetPosY = height();
     if (targetPosY > 160)
     {
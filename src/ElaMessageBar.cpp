@@ -4,8 +4,6 @@
 #include <QHBoxLayout>
 #include <QPainter>
 #include <QPainterPath>
-#include <QPropertyAnimation>
-#include <QResizeEvent>
 
 #include "ElaIconButton.h"
 #include "ElaTheme.h"
@@ -22,11 +20,12 @@ ElaMessageBar::ElaMessageBar(ElaMessageBarType::PositionPolicy policy, ElaMessag
     d->_policy = policy;
     d->_messageMode = messageMode;
     d->_themeMode = eTheme->getThemeMode();
+    d->_parentWidget = parent;
+    d->_displayMsec = displayMsec;
     setFixedHeight(60);
     setMouseTracking(true);
     d->_pOpacity = 1;
     setFont(QFont("微软雅黑"));
-    parent->installEventFilter(this);
     d->_closeButton = new ElaIconButton(ElaIconType::Xmark, 17, d->_closeButtonWidth, 30, this);
     switch (d->_messageMode)
     {
@@ -68,11 +67,47 @@ ElaMessageBar::ElaMessageBar(ElaMessageBarType::PositionPolicy policy, ElaMessag
     mainLayout->addWidget(d->_closeButton);
     setObjectName("ElaMessageBar");
     setStyleSheet("#ElaMessageBar{background-color:transparent;}");
-    d->_messageBarCreate(displayMsec);
+    QFont font = this->font();
+    font.setPixelSize(16);
+    font.setWeight(QFont::Bold);
+    setFont(font);
+    int titleWidth = fontMetrics().horizontalAdvance(d->_title);
+    font.setPixelSize(14);
+    font.setWeight(QFont::Medium);
+    setFont(font);
+    int textWidth = fontMetrics().horizontalAdvance(d->_text);
+    int fixedWidth = d->_closeButtonLeftRightMargin + d->_leftPadding + d->_titleLeftSpacing + d->_textLeftSpacing + d->_closeButtonWidth + titleWidth + textWidth + 2 * d->_shadowBorderWidth;
+    setFixedWidth(fixedWidth > 500 ? 500 : fixedWidth);
 }
 
 ElaMessageBar::~ElaMessageBar()
 {
+    ElaMessageBarManager::getInstance()->removeMessageBar(this);
+}
+
+void ElaMessageBar::post(ElaMessageBarType::MessageMode messageMode, ElaMessageBarType::PositionPolicy policy, QString title, QString text, int displayMsec, QWidget* parent)
+{
+    ElaMessageBarManager::getInstance()->postMessageBarAsync(parent, policy, messageMode, title, text, displayMsec);
+}
+
+void ElaMessageBar::setAggregationWindow(int msec)
+{
+    ElaMessageBarManager::getInstance()->setAggregationWindow(msec);
+}
+
+int ElaMessageBar::getAggregationWindow()
+{
+    return ElaMessageBarManager::getInstance()->getAggregationWindow();
+}
+
+void ElaMessageBar::setMaximumVisibleCount(int count)
+{
+    ElaMessageBarManager::getInstance()->setMaximumVisibleCount(count);
+}
+
+int ElaMessageBar::getMaximumVisibleCount()
+{
+    return ElaMessageBarManager::getInstance()->getMaximumVisibleCount();
 }
 
 void ElaMessageBar::success(ElaMessageBarType::PositionPolicy policy, QString title, QString text, int displayMsec, QWidget* parent)
@@ -94,8 +129,7 @@ void ElaMessageBar::success(ElaMessageBarType::PositionPolicy policy, QString ti
         }
     }
 
-    ElaMessageBar* bar = new ElaMessageBar(policy, ElaMessageBarType::Success, title, text, displayMsec, parent);
-    Q_UNUSED(bar);
+    ElaMessageBarManager::getInstance()->postMessageBar(parent, policy, ElaMessageBarType::Success, title, text, displayMsec);
 }
 
 void ElaMessageBar::warning(ElaMessageBarType::PositionPolicy policy, QString title, QString text, int displayMsec, QWidget* parent)
@@ -115,8 +149,7 @@ void ElaMessageBar::warning(ElaMessageBarType::PositionPolicy policy, QString ti
             return;
         }
     }
-    ElaMessageBar* bar = new ElaMessageBar(policy, ElaMessageBarType::Warning, title, text, displayMsec, parent);
-    Q_UNUSED(bar);
+    ElaMessageBarManager::getInstance()->postMessageBar(parent, policy, ElaMessageBarType::Warning, title, text, displayMsec);
 }
 
 void ElaMessageBar::information(ElaMessageBarType::PositionPolicy policy, QString title, QString text, int displayMsec, QWidget* parent)
@@ -136,8 +169,7 @@ void ElaMessageBar::information(ElaMessageBarType::PositionPolicy policy, QStrin
             return;
         }
     }
-    ElaMessageBar* bar = new ElaMessageBar(policy, ElaMessageBarType::Information, title, text, displayMsec, parent);
-    Q_UNUSED(bar);
+    ElaMessageBarManager::getInstance()->postMessageBar(parent, policy, ElaMessageBarType::Information, title, text, displayMsec);
 }
 
 void ElaMessageBar::error(ElaMessageBarType::PositionPolicy policy, QString title, QString text, int displayMsec, QWidget* parent)
@@ -157,8 +189,7 @@ void ElaMessageBar::error(ElaMessageBarType::PositionPolicy policy, QString titl
             return;
         }
     }
-    ElaMessageBar* bar = new ElaMessageBar(policy, ElaMessageBarType::Error, title, text, displayMsec, parent);
-    Q_UNUSED(bar);
+    ElaMessageBarManager::getInstance()->postMessageBar(parent, policy, ElaMessageBarType::Error, title, text, displayMsec);
 }
 
 void ElaMessageBar::paintEvent(QPaintEvent* event)
@@ -220,64 +251,8 @@ void ElaMessageBar::paintEvent(QPaintEvent* event)
         setMinimumHeight(textHeight + 20);
     }
     painter.restore();
-}
-
-bool ElaMessageBar::eventFilter(QObject* watched, QEvent* event)
-{
-    Q_D(ElaMessageBar);
-    if (watched == parentWidget())
+    if (d->_repeatCount > 1)
     {
-        switch (event->type())
-        {
-        case QEvent::Resize:
-        {
-            QResizeEvent* resizeEvent = dynamic_cast<QResizeEvent*>(event);
-            QSize offsetSize = parentWidget()->size() - resizeEvent->oldSize();
-            if (d->_isNormalDisplay)
-            {
-                switch (d->_policy)
-                {
-                case ElaMessageBarType::Top:
-                {
-                    this->move(parentWidget()->width() / 2 - minimumWidth() / 2, this->y());
-                    break;
-                }
-                case ElaMessageBarType::Bottom:
-                {
-                    this->move(parentWidget()->width() / 2 - minimumWidth() / 2, this->pos().y() + offsetSize.height());
-                    break;
-                }
-                case ElaMessageBarType::Left:
-                case ElaMessageBarType::TopLeft:
-                {
-                    this->move(d->_messageBarHorizontalMargin, this->pos().y());
-                    break;
-                }
-                case ElaMessageBarType::BottomLeft:
-                {
-                    this->move(d->_messageBarHorizontalMargin, this->pos().y() + offsetSize.height());
-                    break;
-                }
-                case ElaMessageBarType::Right:
-                case ElaMessageBarType::TopRight:
-                {
-                    this->move(parentWidget()->width() - minimumWidth() - d->_messageBarHorizontalMargin, this->y());
-                    break;
-                }
-                case ElaMessageBarType::BottomRight:
-                {
-                    this->move(parentWidget()->width() - minimumWidth() - d->_messageBarHorizontalMargin, this->pos().y() + offsetSize.height());
-                    break;
-                }
-                }
-            }
-            break;
-        }
-        default:
-        {
-            break;
-        }
-        }
+        d->_drawRepeatCount(&painter);
     }
-    return QWidget::eventFilter(watched, event);
 }
@@ -235,7 +235,7 @@ void ElaMultiSelectComboBox::showPopup()
             fixedSizeAnimation->setStartValue(1);
             fixedSizeAnimation->setEndValue(containerHeight);
             fixedSizeAnimation->setEasingCurve(QEasingCurve::OutCubic);
-            fixedSizeAnimation->setDuration(400);
+            fixedSizeAnimation->setDuration(eApp->getAnimationDuration(400));
             fixedSizeAnimation->start(QAbstractAnimation::DeleteWhenStopped);
 
             QPropertyAnimation* viewPosAnimation = new QPropertyAnimation(view(), "pos");
@@ -247,7 +247,7 @@ void ElaMultiSelectComboBox::showPopup()
             viewPosAnimation->setStartValue(QPoint(viewPos.x(), viewPos.y() - view()->height()));
             viewPosAnimation->setEndValue(viewPos);
             viewPosAnimation->setEasingCurve(QEasingCurve::OutCubic);
-            viewPosAnimation->setDuration(400);
+            viewPosAnimation->setDuration(eApp->getAnimationDuration(400));
             viewPosAnimation->start(QAbstractAnimation::DeleteWhenStopped);
         }
         //指示器动画
@@ -255,13 +255,13 @@ void ElaMultiSelectComboBox::showPopup()
         connect(rotateAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) {
             update();
         });
-        rotateAnimation->setDuration(300);
+        rotateAnimation->setDuration(eApp->getAnimationDuration(300));
         rotateAnimation->setEasingCurve(QEasingCurve::InOutSine);
         rotateAnimation->setStartValue(d->_pExpandIconRotate);
         rotateAnimation->setEndValue(-180);
         rotateAnimation->start(QAbstractAnimation::DeleteWhenStopped);
         QPropertyAnimation* markAnimation = new QPropertyAnimation(d, "pExpandMarkWidth");
-        markAnimation->setDuration(300);
+        markAnimation->setDuration(eApp->getAnimationDuration(300));
         markAnimation->setEasingCurve(QEasingCurve::InOutSine);
         markAnimation->setStartValue(d->_pExpandMarkWidth);
         qreal step = (width() / 2 - d->_pBorderRadius) / count();
@@ -309,6 +309,7 @@ void ElaMultiSelectComboBox::hidePopup()
                 viewPosAnimation->setStartValue(viewPos);
                 viewPosAnimation->setEndValue(QPoint(viewPos.x(), viewPos.y() - view()->height()));
                 viewPosAnimation->setEasingCurve(QEasingCurve::InCubic);
+                viewPosAnimation->setDuration(eApp->getAnimationDuration(250));
                 viewPosAnimation->start(QAbstractAnimation::DeleteWhenStopped);
 
                 QPropertyAnimation* fixedSizeAnimation = new QPropertyAnimation(container, "maximumHeight");
@@ -318,6 +319,7 @@ void ElaMultiSelectComboBox::hidePopup()
                 fixedSizeAnimation->setStartValue(container->height());
                 fixedSizeAnimation->setEndValue(1);
                 fixedSizeAnimation->setEasingCurve(QEasingCurve::InCubic);
+                fixedSizeAnimation->setDuration(eApp->getAnimationDuration(250));
                 fixedSizeAnimation->start(QAbstractAnimation::DeleteWhenStopped);
                 d->_isAllowHidePopup = false;
             }
@@ -326,13 +328,13 @@ void ElaMultiSelectComboBox::hidePopup()
             connect(rotateAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) {
                 update();
             });
-            rotateAnimation->setDuration(300);
+            rotateAnimation->setDuration(eApp->getAnimationDuration(300));
             rotateAnimation->setEasingCurve(QEasingCurve::InOutSine);
             rotateAnimation->setStartValue(d->_pExpandIconRotate);
             rotateAnimation->setEndValue(0);
             rotateAnimation->start(QAbstractAnimation::DeleteWhenStopped);
             QPropertyAnimation* markAnimation = new QPropertyAnimation(d, "pExpandMarkWidth");
-            markAnimation->setDuration(300);
+            markAnimation->setDuration(eApp->getAnimationDuration(300));
             markAnimation->setEasingCurve(QEasingCurve::InOutSine);
             markAnimation->setStartValue(d->_pExpandMarkWidth);
             markAnimation->setEndValue(0);
@@ -12,6 +12,7 @@
 #include "ElaFooterDelegate.h"
 #include "ElaFooterModel.h"
 #include "ElaIconButton.h"
+#include "ElaImageCache.h"
 #include "ElaInteractiveCard.h"
 #include "ElaMenu.h"
 #include "ElaNavigationModel.h"
@@ -33,11 +34,11 @@ ElaNavigationBar::ElaNavigationBar(QWidget* parent)
 
     //用户卡片
     d->_userCard = new ElaInteractiveCard(this);
-    d->_userCard->setCardPixmap(QPixmap(":/include/Image/Cirno.jpg"));
+    d->_userCard->setCardPixmap(eImageCache->getPixmap(":/include/Image/Cirno.jpg"));
     d->_userCard->setTitle("Ela Tool");
     d->_userCard->setSubTitle("Liniyous@gmail.com");
     connect(d->_userCard, &ElaInteractiveCard::clicked, this, &ElaNavigationBar::userInfoCardClicked);
-    d->_userButton = new ElaIconButton(QPixmap(":/include/Image/Cirno.jpg"), this);
+    d->_userButton = new ElaIconButton(eImageCache->getPixmap(":/include/Image/Cirno.jpg"), this);
     d->_userButton->setFixedSize(36, 36);
     d->_userButton->setVisible(false);
     d->_userButton->setBorderRadius(8);
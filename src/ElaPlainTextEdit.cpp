@@ -6,6 +6,7 @@
 #include <QPainter>
 #include <QPropertyAnimation>
 
+#include "ElaApplication.h"
 #include "ElaEventBus.h"
 #include "ElaMenu.h"
 #include "ElaPlainTextEditPrivate.h"
@@ -51,7 +52,7 @@ void ElaPlainTextEdit::focusInEvent(QFocusEvent* event)
         connect(markAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) {
             update();
         });
-        markAnimation->setDuration(300);
+        markAnimation->setDuration(eApp->getAnimationDuration(300));
         markAnimation->setEasingCurve(QEasingCurve::InOutSine);
         markAnimation->setStartValue(d->_style->getExpandMarkWidth());
         markAnimation->setEndValue(width() / 2 - 3);
@@ -69,7 +70,7 @@ void ElaPlainTextEdit::focusOutEvent(QFocusEvent* event)
         connect(markAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) {
             update();
         });
-        markAnimation->setDuration(300);
+        markAnimation->setDuration(eApp->getAnimationDuration(300));
         markAnimation->setEasingCurve(QEasingCurve::InOutSine);
         markAnimation->setStartValue(d->_style->getExpandMarkWidth());
         markAnimation->setEndValue(0);
@@ -2,10 +2,11 @@
 
 #include <QEvent>
 #include <QPainter>
-#include <QPainterPath>
 #include <QPropertyAnimation>
 #include <QTimer>
 
+#include "ElaApplication.h"
+#include "ElaCardPainter.h"
 #include "ElaPopularCardFloater.h"
 #include "ElaPopularCardPrivate.h"
 #include "ElaPushButton.h"
@@ -89,12 +90,12 @@ bool ElaPopularCard::event(QEvent* event)
         d->_floatTimer->start(450);
         QPropertyAnimation* hoverAnimation = new QPropertyAnimation(d, "pHoverYOffset");
         connect(hoverAnimation, &QPropertyAnimation::valueChanged, this, [=]() { update(); });
-        hoverAnimation->setDuration(130);
+        hoverAnimation->setDuration(eApp->getAnimationDuration(130));
         hoverAnimation->setStartValue(d->_pHoverYOffset);
         hoverAnimation->setEndValue(6);
         hoverAnimation->start(QAbstractAnimation::DeleteWhenStopped);
         QPropertyAnimation* opacityAnimation = new QPropertyAnimation(d, "pHoverOpacity");
-        opacityAnimation->setDuration(130);
+        opacityAnimation->setDuration(eApp->getAnimationDuration(130, true));
         opacityAnimation->setStartValue(d->_pHoverOpacity);
         opacityAnimation->setEndValue(1);
         opacityAnimation->start(QAbstractAnimation::DeleteWhenStopped);
@@ -105,12 +106,12 @@ bool ElaPopularCard::event(QEvent* event)
         d->_floatTimer->stop();
         QPropertyAnimation* hoverAnimation = new QPropertyAnimation(d, "pHoverYOffset");
         connect(hoverAnimation, &QPropertyAnimation::valueChanged, this, [=]() { update(); });
-        hoverAnimation->setDuration(130);
+        hoverAnimation->setDuration(eApp->getAnimationDuration(130));
         hoverAnimation->setStartValue(d->_pHoverYOffset);
         hoverAnimation->setEndValue(0);
         hoverAnimation->start(QAbstractAnimation::DeleteWhenStopped);
         QPropertyAnimation* opacityAnimation = new QPropertyAnimation(d, "pHoverOpacity");
-        opacityAnimation->setDuration(130);
+        opacityAnimation->setDuration(eApp->getAnimationDuration(130, true));
         opacityAnimation->setStartValue(d->_pHoverOpacity);
         opacityAnimation->setEndValue(0);
         opacityAnimation->start(QAbstractAnimation::DeleteWhenStopped);
@@ -137,32 +138,6 @@ void ElaPopularCard::paintEvent(QPaintEvent* event)
         return;
     }
     QPainter painter(this);
-    painter.save();
-    painter.setRenderHints(QPainter::SmoothPixmapTransform | QPainter::Antialiasing | QPainter::TextAntialiasing);
-    if (underMouse())
-    {
-        // 阴影绘制
-        painter.setOpacity(d->_pHoverOpacity);
-        QRect shadowRect = rect();
-        shadowRect.adjust(0, 0, 0, -d->_pHoverYOffset);
-        eTheme->drawEffectShadow(&painter, shadowRect, d->_shadowBorderWidth, d->_pBorderRadius);
-    }
-    QRectF foregroundRect(d->_shadowBorderWidth, d->_shadowBorderWidth - d->_pHoverYOffset + 1, width() - 2 * d->_shadowBorderWidth, height() - 2 * d->_shadowBorderWidth);
-    //背景绘制
-    painter.setOpacity(1);
-    painter.setPen(underMouse() ? ElaThemeColor(d->_themeMode, PopupBorderHover) : ElaThemeColor(d->_themeMode, BasicBorder));
-    painter.setBrush(ElaThemeColor(d->_themeMode, BasicBaseAlpha));
-    painter.drawRoundedRect(foregroundRect, d->_pBorderRadius, d->_pBorderRadius);
-    //图片绘制
-    painter.save();
-    QRectF pixRect(foregroundRect.x() + foregroundRect.height() * 0.15, foregroundRect.y() + foregroundRect.height() * 0.15, foregroundRect.height() * 0.7, foregroundRect.height() * 0.7);
-    QPainterPath pixPath;
-    pixPath.addRoundedRect(pixRect, 4, 4);
-    painter.setClipPath(pixPath);
-    painter.drawPixmap(pixRect, d->_pCardPixmap, d->_pCardPixmap.rect());
-    painter.restore();
-
-    //文字绘制
     //计算按钮最终矩形
     int buttonTargetWidth = d->_floater->_overButton->fontMetrics().horizontalAdvance(d->_floater->_overButton->text()) + 40;
     if (buttonTargetWidth > width() * 0.25)
@@ -170,56 +145,20 @@ void ElaPopularCard::paintEvent(QPaintEvent* event)
         buttonTargetWidth = width() * 0.25;
     }
     //处理ElaPushButton的阴影偏移
-    d->_buttonTargetRect = QRect(QPoint(width() + 2 * d->_floater->_floatGeometryOffset - d->_shadowBorderWidth + 3 - foregroundRect.height() * 0.15 - buttonTargetWidth, foregroundRect.height() * 0.15 - 3), QSize(buttonTargetWidth, 36));
-
-    // Title
-    painter.setPen(ElaThemeColor(d->_themeMode, BasicText));
-    QFont font = painter.font();
-    font.setWeight(QFont::Bold);
-    font.setPixelSize(15);
-    painter.setFont(font);
-    int titleHeight = painter.fontMetrics().height();
-    QRectF titleRect(pixRect.right() + d->_textHSpacing, pixRect.y(), d->_floater->_floatGeometryOffset * 2 + foregroundRect.width() - pixRect.width() - d->_textHSpacing * 2 - foregroundRect.height() * 0.15 - buttonTargetWidth, titleHeight);
-    QString titleText = painter.fontMetrics().elidedText(d->_pTitle, Qt::ElideRight, titleRect.width());
-    painter.drawText(titleRect, Qt::AlignLeft | Qt::AlignTop | Qt::TextSingleLine, titleText);
-
-    // SubTitle
-    font.setWeight(QFont::DemiBold);
-    font.setPixelSize(13);
-    painter.setFont(font);
-    int subTitleHeight = painter.fontMetrics().height();
-    QRectF subTitleRect(pixRect.right() + d->_textHSpacing, titleRect.bottom() + d->_textVSpacing, d->_floater->_floatGeometryOffset * 2 + foregroundRect.width() - pixRect.width() - d->_textHSpacing * 2 - foregroundRect.height() * 0.15 - buttonTargetWidth,
-                        subTitleHeight);
-    QString subTitleText = painter.fontMetrics().elidedText(d->_pSubTitle, Qt::ElideRight, subTitleRect.width());
-    painter.drawText(subTitleRect, Qt::AlignLeft | Qt::AlignTop | Qt::TextSingleLine, subTitleText);
+    qreal foregroundHeight = height() - 2 * d->_shadowBorderWidth;
+    d->_buttonTargetRect = QRect(QPoint(width() + 2 * d->_floater->_floatGeometryOffset - d->_shadowBorderWidth + 3 - foregroundHeight * 0.15 - buttonTargetWidth, foregroundHeight * 0.15 - 3), QSize(buttonTargetWidth, 36));
 
-    // InteractiveTips
-    int tipWidth = painter.fontMetrics().horizontalAdvance(d->_pInteractiveTips);
-    int tipHeight = painter.fontMetrics().height();
-    if (!d->_pInteractiveTips.isEmpty())
-    {
-        font.setWeight(QFont::DemiBold);
-        font.setPixelSize(12);
-        painter.setFont(font);
-        //覆盖背景绘制
-        QRectF tipRect(foregroundRect.right() - d->_textHSpacing - tipWidth, foregroundRect.bottom() - d->_textHSpacing - tipHeight, foregroundRect.width() / 2 - d->_textHSpacing, tipHeight);
-        painter.setPen(Qt::NoPen);
-        painter.setBrush(ElaThemeColor(d->_themeMode, BasicBaseDeep));
-        QRectF baseRect = tipRect;
-        baseRect.setRight(tipRect.x() + tipWidth);
-        baseRect.adjust(-7, -3, 4, 3);
-        d->_interactiveTipsBaseRect = baseRect;
-        painter.drawRoundedRect(baseRect, 6, 6);
-        //文字绘制
-        painter.setPen(ElaThemeColor(d->_themeMode, BasicText));
-        painter.drawText(tipRect, Qt::AlignLeft | Qt::AlignVCenter | Qt::TextSingleLine, d->_pInteractiveTips);
-    }
-    else
-    {
-        QRectF tipRect(foregroundRect.right() - d->_textHSpacing - 50, foregroundRect.bottom() - d->_textHSpacing - tipHeight, foregroundRect.width() / 2 - d->_textHSpacing, tipHeight);
-        tipRect.setRight(tipRect.x() + tipWidth);
-        tipRect.adjust(-7, -3, 4, 3);
-        d->_interactiveTipsBaseRect = tipRect;
-    }
-    painter.restore();
+    ElaCardPaintData paintData;
+    paintData.borderRadius = d->_pBorderRadius;
+    paintData.cardPixmap = d->_pCardPixmap;
+    paintData.title = d->_pTitle;
+    paintData.subTitle = d->_pSubTitle;
+    paintData.interactiveTips = d->_pInteractiveTips;
+    paintData.shadowBorderWidth = d->_shadowBorderWidth;
+    paintData.textHSpacing = d->_textHSpacing;
+    paintData.textVSpacing = d->_textVSpacing;
+    paintData.hoverYOffset = d->_pHoverYOffset;
+    paintData.hoverOpacity = d->_pHoverOpacity;
+    paintData.textWidthOffset = d->_floater->_floatGeometryOffset * 2 - buttonTargetWidth;
+    d->_interactiveTipsBaseRect = ElaCardPainter::drawPopularCard(&painter, rect(), paintData, d->_themeMode, underMouse());
 }
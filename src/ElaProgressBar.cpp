@@ -3,6 +3,7 @@
 #include <QPropertyAnimation>
 #include <QStyleOption>
 
+#include "ElaApplication.h"
 #include "ElaProgressBarPrivate.h"
 #include "ElaProgressBarStyle.h"
 ElaProgressBar::ElaProgressBar(QWidget* parent)
@@ -52,7 +53,19 @@ void ElaProgressBar::setMaximum(int maximum)
 void ElaProgressBar::paintEvent(QPaintEvent* event)
 {
     Q_D(ElaProgressBar);
-    if (!d->_isBusyAnimation && minimum() == 0 && maximum() == 0)
+    if (minimum() == 0 && maximum() == 0 && eApp->getAnimationDuration(2000) == 0)
+    {
+        // 动画关闭时居中绘制静态忙碌块
+        if (d->_isBusyAnimation)
+        {
+            d->_isBusyAnimation = false;
+            d->_busyAnimation->stop();
+        }
+        int busyStartValue = ((orientation() == Qt::Horizontal ? width() : height()) - 75) / 2;
+        d->_style->setProperty("busyStartValue", busyStartValue);
+        d->_style->setProperty("busyEndValue", busyStartValue + 75);
+    }
+    else if (!d->_isBusyAnimation && minimum() == 0 && maximum() == 0)
     {
         QStyleOptionProgressBar option;
         option.initFrom(this);
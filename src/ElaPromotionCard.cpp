@@ -7,6 +7,7 @@
 #include <QRadialGradient>
 #include <QtMath>
 
+#include "ElaApplication.h"
 #include "ElaPromotionCardPrivate.h"
 #include "ElaTheme.h"
 Q_PROPERTY_CREATE_Q_CPP(ElaPromotionCard, int, BorderRadius)
@@ -108,6 +109,9 @@ bool ElaPromotionCard::event(QEvent* event)
     case QEvent::MouseButtonPress:
     {
         QMouseEvent* mouseEvent = dynamic_cast<QMouseEvent*>(event);
+        d->_isPressAnimationFinished = false;
+        d->_pressGradient->setFocalPoint(mouseEvent->pos());
+        d->_pressGradient->setCenter(mouseEvent->pos());
         QPropertyAnimation* opacityAnimation = new QPropertyAnimation(d, "pPressOpacity");
         connect(opacityAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) {
             update();
@@ -115,7 +119,7 @@ bool ElaPromotionCard::event(QEvent* event)
         connect(opacityAnimation, &QPropertyAnimation::finished, this, [=]() {
             d->_isPressAnimationFinished = true;
         });
-        opacityAnimation->setDuration(300);
+        opacityAnimation->setDuration(eApp->getAnimationDuration(300, true));
         opacityAnimation->setEasingCurve(QEasingCurve::InQuad);
         opacityAnimation->setStartValue(1);
         opacityAnimation->setEndValue(0);
@@ -125,14 +129,11 @@ bool ElaPromotionCard::event(QEvent* event)
         connect(pressAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) {
             d->_pressGradient->setRadius(value.toReal());
         });
-        pressAnimation->setDuration(300);
+        pressAnimation->setDuration(eApp->getAnimationDuration(300));
         pressAnimation->setEasingCurve(QEasingCurve::InQuad);
         pressAnimation->setStartValue(30);
         pressAnimation->setEndValue(d->_getLongestDistance(mouseEvent->pos()) * 1.8);
         pressAnimation->start(QAbstractAnimation::DeleteWhenStopped);
-        d->_isPressAnimationFinished = false;
-        d->_pressGradient->setFocalPoint(mouseEvent->pos());
-        d->_pressGradient->setCenter(mouseEvent->pos());
         //点击后隐藏Hover效果
         d->_startHoverOpacityAnimation(false);
         break;
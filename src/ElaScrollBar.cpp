@@ -29,7 +29,6 @@ ElaScrollBar::ElaScrollBar(QWidget* parent)
     setStyle(scrollBarStyle);
     d->_slideSmoothAnimation = new QPropertyAnimation(this, "value");
     d->_slideSmoothAnimation->setEasingCurve(QEasingCurve::OutSine);
-    d->_slideSmoothAnimation->setDuration(300);
     connect(d->_slideSmoothAnimation, &QPropertyAnimation::finished, this, [=]() { d->_scrollValue = value(); });
 
     d->_expandTimer = new QTimer(this);
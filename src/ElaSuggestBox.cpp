@@ -8,6 +8,8 @@
 #include <QMap>
 #include <QPainter>
 #include <QPainterPath>
+#include <QThread>
+#include <QTimer>
 #include <QVBoxLayout>
 
 #include "ElaBaseListView.h"
@@ -17,11 +19,14 @@
 #include "ElaSuggestBoxSearchViewContainer.h"
 #include "ElaSuggestDelegate.h"
 #include "ElaSuggestModel.h"
+#include "ElaSuggestProvider.h"
+#include "ElaSuggestProviderWorker.h"
 #include "ElaTheme.h"
 #include "private/ElaSuggestBoxPrivate.h"
 
 Q_PROPERTY_CREATE_Q_CPP(ElaSuggestBox, int, BorderRadius)
 Q_PROPERTY_CREATE_Q_CPP(ElaSuggestBox, Qt::CaseSensitivity, CaseSensitivity)
+Q_PROPERTY_CREATE_Q_CPP(ElaSuggestBox, int, DebounceMsec)
 ElaSuggestBox::ElaSuggestBox(QWidget* parent)
     : QWidget{parent}, d_ptr(new ElaSuggestBoxPrivate())
 {
@@ -30,6 +35,8 @@ ElaSuggestBox::ElaSuggestBox(QWidget* parent)
     d->q_ptr = this;
     d->_pBorderRadius = 6;
     d->_pCaseSensitivity = Qt::CaseInsensitive;
+    d->_pDebounceMsec = 200;
+    d->_pMaxSuggestCount = 100;
     d->_searchEdit = new ElaLineEdit(this);
     d->_searchEdit->setFixedHeight(35);
     d->_searchEdit->setPlaceholderText("查找功能");
@@ -76,6 +83,11 @@ ElaSuggestBox::ElaSuggestBox(QWidget* parent)
     connect(d->_searchEdit, &ElaLineEdit::focusIn, d, &ElaSuggestBoxPrivate::onSearchEditTextEdit);
     connect(d->_searchView, &ElaBaseListView::clicked, d, &ElaSuggestBoxPrivate::onSearchViewClicked);
 
+    // 数据源查询防抖
+    d->_debounceTimer = new QTimer(this);
+    d->_debounceTimer->setSingleShot(true);
+    connect(d->_debounceTimer, &QTimer::timeout, d, &ElaSuggestBoxPrivate::onDebounceTimeout);
+
     // 焦点事件
     connect(d->_searchEdit, &ElaLineEdit::wmFocusOut, this, [d]() {
         d->_startCloseAnimation();
@@ -84,6 +96,14 @@ ElaSuggestBox::ElaSuggestBox(QWidget* parent)
 
 ElaSuggestBox::~ElaSuggestBox()
 {
+    Q_D(ElaSuggestBox);
+    if (d->_providerThread)
+    {
+        d->_providerWorker->setSuggestProvider(nullptr);
+        d->_providerThread->quit();
+        d->_providerThread->wait();
+        delete d->_providerWorker;
+    }
 }
 
 void ElaSuggestBox::setPlaceholderText(const QString& placeholderText)
@@ -95,43 +115,90 @@ void ElaSuggestBox::setPlaceholderText(const QString& placeholderText)
 void ElaSuggestBox::addSuggestion(const QString& suggestText, const QVariantMap& suggestData)
 {
     Q_D(ElaSuggestBox);
-    ElaSuggestion* suggest = new ElaSuggestion(this);
-    suggest->setSuggestText(suggestText);
-    suggest->setSuggestData(suggestData);
-    d->_suggestionVector.append(suggest);
+    d->_suggestionStore.appendSuggestion(ElaIconType::None, suggestText, suggestData);
 }
 
 void ElaSuggestBox::addSuggestion(ElaIconType::IconName icon, const QString& suggestText, const QVariantMap& suggestData)
 {
     Q_D(ElaSuggestBox);
-    ElaSuggestion* suggest = new ElaSuggestion(this);
-    suggest->setElaIcon(icon);
-    suggest->setSuggestText(suggestText);
-    suggest->setSuggestData(suggestData);
-    d->_suggestionVector.append(suggest);
+    d->_suggestionStore.appendSuggestion(icon, suggestText, suggestData);
 }
 
 void ElaSuggestBox::removeSuggestion(const QString& suggestText)
 {
     Q_D(ElaSuggestBox);
-    foreach (auto suggest, d->_suggestionVector)
+    if (d->_suggestionStore.removeSuggestion(suggestText) > 0)
     {
-        if (suggest->getSuggestText() == suggestText)
-        {
-            d->_suggestionVector.removeOne(suggest);
-            suggest->deleteLater();
-        }
+        d->_refreshLocalSuggestion();
     }
 }
 
 void ElaSuggestBox::removeSuggestion(int index)
 {
     Q_D(ElaSuggestBox);
-    if (index >= d->_suggestionVector.count())
+    if (index >= d->_suggestionStore.count())
+    {
+        return;
+    }
+    d->_suggestionStore.removeSuggestion(index);
+    d->_refreshLocalSuggestion();
+}
+
+void ElaSuggestBox::setMaxSuggestCount(int maxSuggestCount)
+{
+    Q_D(ElaSuggestBox);
+    if (d->_pMaxSuggestCount == maxSuggestCount)
+    {
+        return;
+    }
+    d->_pMaxSuggestCount = maxSuggestCount;
+    // 缓存结果按旧上限截断 不可复用
+    d->_suggestCache.clear();
+    // 未返回的查询按旧上限截断 以当前输入和新上限重新查询 旧结果因请求ID不符被丢弃
+    if (d->_currentRequestID != 0 && !d->_debounceTimer->isActive() && !d->_searchEdit->text().isEmpty())
+    {
+        d->_pendingQueryText = d->_searchEdit->text();
+        d->onDebounceTimeout();
+    }
+    Q_EMIT pMaxSuggestCountChanged();
+}
+
+int ElaSuggestBox::getMaxSuggestCount() const
+{
+    Q_D(const ElaSuggestBox);
+    return d->_pMaxSuggestCount;
+}
+
+void ElaSuggestBox::setSuggestProvider(ElaSuggestProvider* provider)
+{
+    Q_D(ElaSuggestBox);
+    if (d->_suggestProvider == provider)
     {
         return;
     }
-    ElaSuggestion* suggest = d->_suggestionVector[index];
-    d->_suggestionVector.removeOne(suggest);
-    suggest->deleteLater();
+    d->_cancelProviderQuery();
+    d->_suggestCache.clear();
+    if (!d->_providerThread)
+    {
+        d->_providerThread = new QThread(this);
+        d->_providerWorker = new ElaSuggestProviderWorker();
+        d->_providerWorker->moveToThread(d->_providerThread);
+        connect(d, &ElaSuggestBoxPrivate::querySuggestion, d->_providerWorker, &ElaSuggestProviderWorker::onQuerySuggestion);
+        connect(d->_providerWorker, &ElaSuggestProviderWorker::querySuggestionFinished, d, &ElaSuggestBoxPrivate::onQuerySuggestionFinished);
+        d->_providerThread->start();
+    }
+    d->_providerWorker->setSuggestProvider(provider);
+    d->_suggestProvider = provider;
+}
+
+ElaSuggestProvider* ElaSuggestBox::getSuggestProvider() const
+{
+    Q_D(const ElaSuggestBox);
+    return d->_suggestProvider;
+}
+
+void ElaSuggestBox::clearSuggestCache()
+{
+    Q_D(ElaSuggestBox);
+    d->_suggestCache.clear();
 }
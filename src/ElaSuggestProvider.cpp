@@ -0,0 +1,21 @@
+#include "ElaSuggestProvider.h"
+
+#include "ElaSuggestProviderWorker.h"
+ElaSuggestProvider::ElaSuggestProvider(QObject* parent)
+    : QObject{parent}
+{
+}
+
+ElaSuggestProvider::~ElaSuggestProvider()
+{
+}
+
+bool ElaSuggestProvider::isSuggestionMatched(const ElaSuggestResult& suggestion, const QString& queryText, Qt::CaseSensitivity caseSensitivity) const
+{
+    return suggestion.suggestText.contains(queryText, caseSensitivity);
+}
+
+bool ElaSuggestProvider::isQueryCanceled() const
+{
+    return ElaSuggestProviderWorker::isCurrentQueryCanceled();
+}
@@ -5,6 +5,7 @@
 #include <QMimeData>
 #include <QMouseEvent>
 
+#include "ElaSnapshotCache.h"
 #include "ElaTabBarPrivate.h"
 #include "ElaTabBarStyle.h"
 ElaTabBar::ElaTabBar(QWidget* parent)
@@ -28,7 +29,8 @@ void ElaTabBar::mousePressEvent(QMouseEvent* event)
 {
     Q_D(ElaTabBar);
     QTabBar::mousePressEvent(event);
-    d->_lastDragPix = grab(tabRect(currentIndex()));
+    d->_lastDragPix = QPixmap();
+    d->_lastDragPix = eSnapshotCache->renderSnapshot(this, tabRect(currentIndex()));
     Q_EMIT tabBarPress(currentIndex());
 }
 
@@ -53,11 +55,26 @@ void ElaTabBar::mouseMoveEvent(QMouseEvent* event)
         data->setProperty("ElaTabBarObject", QVariant::fromValue(this));
         data->setProperty("QDragObject", QVariant::fromValue(drag));
         drag->setMimeData(data);
+        d->_isTabDragging = true;
         Q_EMIT tabDragCreate(drag);
+        d->_isTabDragging = false;
+        // 拖拽已结束 归还快照缓冲
+        d->_releaseDragPix();
     }
     QTabBar::mouseMoveEvent(event);
 }
 
+void ElaTabBar::mouseReleaseEvent(QMouseEvent* event)
+{
+    Q_D(ElaTabBar);
+    QTabBar::mouseReleaseEvent(event);
+    // 拖拽开始前会收到合成的释放事件 此时快照仍需保留
+    if (!d->_isTabDragging)
+    {
+        d->_releaseDragPix();
+    }
+}
+
 void ElaTabBar::dragEnterEvent(QDragEnterEvent* event)
 {
     if (event->mimeData()->property("DragType").toString() == "ElaTabBarDrag")
@@ -11,6 +11,8 @@ ElaTheme::ElaTheme(QObject* parent)
     Q_D(ElaTheme);
     d->q_ptr = this;
     d->_initThemeColor();
+    d->_publishThemePalette(ElaThemeType::Light);
+    d->_publishThemePalette(ElaThemeType::Dark);
 }
 
 ElaTheme::~ElaTheme()
@@ -21,6 +23,7 @@ void ElaTheme::setThemeMode(ElaThemeType::ThemeMode themeMode)
 {
     Q_D(ElaTheme);
     d->_themeMode = themeMode;
+    d->_updateCurrentPalette();
     Q_EMIT themeModeChanged(d->_themeMode);
 }
 
@@ -60,10 +63,12 @@ void ElaTheme::setThemeColor(ElaThemeType::ThemeMode themeMode, ElaThemeType::Th
     {
         d->_darkThemeColorList[themeColor] = newColor;
     }
+    d->_publishThemePalette(themeMode);
 }
 
 const QColor& ElaTheme::getThemeColor(ElaThemeType::ThemeMode themeMode, ElaThemeType::ThemeColor themeColor)
 {
+    // 引用指向颜色表而非快照 快照替换后仍然有效
     Q_D(ElaTheme);
     if (themeMode == ElaThemeType::Light)
     {
@@ -74,3 +79,14 @@ const QColor& ElaTheme::getThemeColor(ElaThemeType::ThemeMode themeMode, ElaThem
         return d->_darkThemeColorList[themeColor];
     }
 }
+
+const ElaThemePalette* ElaTheme::getThemePalette() const
+{
+    return getThemePalette(d_ptr->_themeMode);
+}
+
+const ElaThemePalette* ElaTheme::getThemePalette(ElaThemeType::ThemeMode themeMode) const
+{
+    Q_D(const ElaTheme);
+    return themeMode == ElaThemeType::Light ? d->_lightPalette.data() : d->_darkPalette.data();
+}
@@ -0,0 +1,41 @@
+#include "ElaThemePalette.h"
+
+#include <algorithm>
+
+#include "ElaTheme.h"
+QAtomicPointer<const ElaThemePalette> ElaThemePalette::_currentPalette;
+QAtomicPointer<const ElaThemePalette> ElaThemePalette::_lightPalette;
+QAtomicPointer<const ElaThemePalette> ElaThemePalette::_darkPalette;
+ElaThemePalette::ElaThemePalette(ElaThemeType::ThemeMode themeMode, const QColor* colorList)
+    : _themeMode(themeMode)
+{
+    std::copy(colorList, colorList + ThemeColorCount, _colorList);
+}
+
+ElaThemePalette::~ElaThemePalette()
+{
+}
+
+const ElaThemePalette* ElaThemePalette::getThemePalette()
+{
+    const ElaThemePalette* palette = _currentPalette.loadAcquire();
+    if (!palette)
+    {
+        // 首次访问时由ElaTheme构造并发布快照
+        ElaTheme::getInstance();
+        palette = _currentPalette.loadAcquire();
+    }
+    return palette;
+}
+
+const ElaThemePalette* ElaThemePalette::getThemePalette(ElaThemeType::ThemeMode themeMode)
+{
+    QAtomicPointer<const ElaThemePalette>& modePalette = themeMode == ElaThemeType::Light ? _lightPalette : _darkPalette;
+    const ElaThemePalette* palette = modePalette.loadAcquire();
+    if (!palette)
+    {
+        ElaTheme::getInstance();
+        palette = modePalette.loadAcquire();
+    }
+    return palette;
+}
@@ -5,6 +5,7 @@
 #include <QPainterPath>
 #include <QPropertyAnimation>
 
+#include "ElaApplication.h"
 #include "ElaTheme.h"
 #include "private/ElaToggleButtonPrivate.h"
 Q_PROPERTY_CREATE_Q_CPP(ElaToggleButton, int, BorderRadius)
@@ -91,7 +92,7 @@ void ElaToggleButton::mouseReleaseEvent(QMouseEvent* event)
     connect(alphaAnimation, &QPropertyAnimation::finished, this, [=]() {
         d->_isAlphaAnimationFinished = true;
     });
-    alphaAnimation->setDuration(250);
+    alphaAnimation->setDuration(eApp->getAnimationDuration(250, true));
     alphaAnimation->setStartValue(d->_pToggleAlpha);
     if (d->_isToggled)
     {
@@ -7,6 +7,7 @@
 #include <QPropertyAnimation>
 
 #include "DeveloperComponents/ElaToolButtonStyle.h"
+#include "ElaApplication.h"
 #include "ElaIcon.h"
 #include "ElaMenu.h"
 #include "ElaToolButtonPrivate.h"
@@ -95,7 +96,7 @@ bool ElaToolButton::eventFilter(QObject* watched, QEvent* event)
             connect(rotateAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) {
                 update();
             });
-            rotateAnimation->setDuration(300);
+            rotateAnimation->setDuration(eApp->getAnimationDuration(300));
             rotateAnimation->setEasingCurve(QEasingCurve::InOutSine);
             rotateAnimation->setStartValue(d->_toolButtonStyle->getExpandIconRotate());
             rotateAnimation->setEndValue(-180);
@@ -109,7 +110,7 @@ bool ElaToolButton::eventFilter(QObject* watched, QEvent* event)
             connect(rotateAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) {
                 update();
             });
-            rotateAnimation->setDuration(300);
+            rotateAnimation->setDuration(eApp->getAnimationDuration(300));
             rotateAnimation->setEasingCurve(QEasingCurve::InOutSine);
             rotateAnimation->setStartValue(d->_toolButtonStyle->getExpandIconRotate());
             rotateAnimation->setEndValue(0);
@@ -84,6 +84,16 @@ enum ThemeColor
 Q_ENUM_CREATE(ThemeColor)
 Q_END_ENUM_CREATE(ElaThemeType)
 
+Q_BEGIN_ENUM_CREATE(ElaApplicationType)
+enum AnimationPolicy
+{
+    Full = 0x0000,
+    Reduced = 0x0001,
+    Off = 0x0002,
+};
+Q_ENUM_CREATE(AnimationPolicy)
+Q_END_ENUM_CREATE(ElaApplicationType)
+
 Q_BEGIN_ENUM_CREATE(ElaAppBarType)
 enum ButtonType
 {
@@ -194,6 +204,24 @@ enum PixMode
 Q_ENUM_CREATE(PixMode)
 Q_END_ENUM_CREATE(ElaCardPixType)
 
+Q_BEGIN_ENUM_CREATE(ElaCardGridType)
+enum CardMode
+{
+    PopularCard = 0x0000,
+    InteractiveCard = 0x0001,
+    ImageCard = 0x0002,
+};
+Q_ENUM_CREATE(CardMode)
+
+// DisplayRole为标题 DecorationRole为图片(QPixmap/QImage)
+enum CardRole
+{
+    SubTitleRole = 0x0100,
+    InteractiveTipsRole = 0x0101,
+};
+Q_ENUM_CREATE(CardRole)
+Q_END_ENUM_CREATE(ElaCardGridType)
+
 Q_BEGIN_ENUM_CREATE(ElaGraphicsSceneType)
 enum SceneMode
 {
@@ -203,6 +231,14 @@ enum SceneMode
     ItemLink = 0x0003,
 };
 Q_ENUM_CREATE(SceneMode)
+
+enum ItemIndexMode
+{
+    NoIndex = 0x0000,      // 线性遍历 适合少量图元
+    BspTreeIndex = 0x0001, // Qt内置BSP索引 查询与绘制快 频繁移动时重建开销大
+    GridIndex = 0x0002,    // 均匀网格索引 移动仅在跨越网格时更新 适合频繁拖动的大场景
+};
+Q_ENUM_CREATE(ItemIndexMode)
 Q_END_ENUM_CREATE(ElaGraphicsSceneType)
 
 Q_BEGIN_ENUM_CREATE(ElaMessageBarType)
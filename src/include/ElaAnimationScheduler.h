@@ -0,0 +1,44 @@
+#ifndef ELAANIMATIONSCHEDULER_H
+#define ELAANIMATIONSCHEDULER_H
+
+#include <QEasingCurve>
+#include <QObject>
+#include <functional>
+
+#include "singleton.h"
+#include "stdafx.h"
+
+#define eAnimationScheduler ElaAnimationScheduler::getInstance()
+class ElaAnimationSchedulerPrivate;
+class ELA_EXPORT ElaAnimationScheduler : public QObject
+{
+    Q_OBJECT
+    Q_Q_CREATE(ElaAnimationScheduler)
+    Q_SINGLETON_CREATE_H(ElaAnimationScheduler)
+private:
+    explicit ElaAnimationScheduler(QObject* parent = nullptr);
+    ~ElaAnimationScheduler();
+
+public:
+    using ValueSetter = std::function<void(qreal)>;
+    using FinishedCallback = std::function<void()>;
+    // 所有动画共用一个帧驱动 每帧统一推进并对updateWidget合并刷新 仅限GUI线程调用
+    // 时长受ElaApplication动画策略约束 关闭时直接写入终值并同步触发finishedCallback 返回0
+    // 同一target与animationKey(需为静态字符串)的动画会替换旧动画 被替换及被停止的动画不触发finishedCallback
+    quint64 startAnimation(QObject* target, const char* animationKey, qreal startValue, qreal endValue, int duration, const QEasingCurve& easingCurve, ValueSetter valueSetter, QWidget* updateWidget = nullptr, FinishedCallback finishedCallback = nullptr);
+    bool stopAnimation(quint64 animationID);
+    bool stopAnimation(QObject* target, const char* animationKey);
+    void stopAnimations(QObject* target);
+    bool getIsAnimationRunning(quint64 animationID) const;
+
+    int getActiveAnimationCount() const;
+    int getPoolSize() const;
+    quint64 getFrameCount() const;
+    qint64 getLastFrameCostNsec() const;
+    qint64 getAverageFrameCostNsec() const;
+    void resetStatistics();
+Q_SIGNALS:
+    Q_SIGNAL void frameFinished(int activeAnimationCount, qint64 frameCostNsec);
+};
+
+#endif // ELAANIMATIONSCHEDULER_H
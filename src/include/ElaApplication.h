@@ -4,6 +4,7 @@
 #include <QIcon>
 #include <QObject>
 
+#include "Def.h"
 #include "singleton.h"
 #include "stdafx.h"
 #define eApp ElaApplication::getInstance()
@@ -15,6 +16,7 @@ class ELA_EXPORT ElaApplication : public QObject
     Q_SINGLETON_CREATE_H(ElaApplication)
     Q_PROPERTY_CREATE_Q_H(bool, IsEnableMica)
     Q_PROPERTY_CREATE_Q_H(QString, MicaImagePath)
+    Q_PROPERTY_CREATE_Q_H(ElaApplicationType::AnimationPolicy, AnimationPolicy)
 private:
     explicit ElaApplication(QObject* parent = nullptr);
     ~ElaApplication();
@@ -23,6 +25,8 @@ public:
     void init();
     void syncMica(QWidget* widget, bool isSync = true);
     static bool containsCursorToItem(QWidget* item);
+    // 按动画策略换算时长 Reduced下位移类动画直接到位 渐变类动画缩短 Off下均为0
+    int getAnimationDuration(int duration, bool isCrossfade = false) const;
 };
 
 #endif // ELAAPPLICATION_H
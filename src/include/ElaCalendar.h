@@ -16,6 +16,13 @@ class ELA_EXPORT ElaCalendar : public QWidget
 public:
     explicit ElaCalendar(QWidget* parent = nullptr);
     ~ElaCalendar();
+
+    // 日期标注 在日视图中以角标显示 annotationText非空时代替数量显示 count<=0且文本为空时移除
+    void setDateAnnotation(QDate date, int count, QString annotationText = QString());
+    void removeDateAnnotation(QDate date);
+    void clearDateAnnotation();
+    int getDateAnnotationCount(QDate date) const;
+    QString getDateAnnotationText(QDate date) const;
 Q_SIGNALS:
     Q_SIGNAL void clicked(QDate date);
 
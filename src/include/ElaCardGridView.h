@@ -0,0 +1,45 @@
+#ifndef ELACARDGRIDVIEW_H
+#define ELACARDGRIDVIEW_H
+
+#include <QAbstractItemView>
+
+#include "Def.h"
+#include "stdafx.h"
+
+class ElaCardGridViewPrivate;
+// 模型驱动的卡片网格 按流式排列等尺寸卡片 仅绘制可见项 不为每张卡片创建控件 布局与内存开销与项数无关
+// 默认不可选 设置为ExtendedSelection或MultiSelection后支持拖动框选
+class ELA_EXPORT ElaCardGridView : public QAbstractItemView
+{
+    Q_OBJECT
+    Q_Q_CREATE(ElaCardGridView)
+    Q_PROPERTY_CREATE_Q_H(ElaCardGridType::CardMode, CardMode)
+    Q_PROPERTY_CREATE_Q_H(QSize, ItemSize)
+    Q_PROPERTY_CREATE_Q_H(int, ItemSpacing)
+public:
+    explicit ElaCardGridView(QWidget* parent = nullptr);
+    ~ElaCardGridView();
+
+    void setModel(QAbstractItemModel* model) override;
+    QRect visualRect(const QModelIndex& index) const override;
+    void scrollTo(const QModelIndex& index, ScrollHint hint = EnsureVisible) override;
+    QModelIndex indexAt(const QPoint& point) const override;
+
+protected:
+    QModelIndex moveCursor(CursorAction cursorAction, Qt::KeyboardModifiers modifiers) override;
+    int horizontalOffset() const override;
+    int verticalOffset() const override;
+    bool isIndexHidden(const QModelIndex& index) const override;
+    void setSelection(const QRect& rect, QItemSelectionModel::SelectionFlags command) override;
+    QRegion visualRegionForSelection(const QItemSelection& selection) const override;
+    void updateGeometries() override;
+    void rowsInserted(const QModelIndex& parent, int start, int end) override;
+
+    virtual void paintEvent(QPaintEvent* event) override;
+    virtual void mousePressEvent(QMouseEvent* event) override;
+    virtual void mouseMoveEvent(QMouseEvent* event) override;
+    virtual void mouseReleaseEvent(QMouseEvent* event) override;
+    virtual bool viewportEvent(QEvent* event) override;
+};
+
+#endif // ELACARDGRIDVIEW_H
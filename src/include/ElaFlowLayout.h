@@ -28,6 +28,7 @@ public:
     void setGeometry(const QRect& rect) override;
     QSize sizeHint() const override;
     QLayoutItem* takeAt(int index) override;
+    void invalidate() override;
 
     void setIsAnimation(bool isAnimation);
 };
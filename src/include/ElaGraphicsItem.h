@@ -41,8 +41,12 @@ public:
 protected:
     virtual QRectF boundingRect() const override;
     virtual void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget = nullptr) override;
+    virtual QVariant itemChange(GraphicsItemChange change, const QVariant& value) override;
     friend QDataStream& operator<<(QDataStream& stream, const ElaGraphicsItem* item);
     friend QDataStream& operator>>(QDataStream& stream, ElaGraphicsItem* item);
+
+private:
+    friend class ElaGraphicsScenePrivate;
 };
 
 #endif // ELAGRAPHICSITEM_H
@@ -28,6 +28,9 @@ public:
 protected:
     void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget = nullptr) override;
     QRectF boundingRect() const override;
+
+private:
+    friend class ElaGraphicsScenePrivate;
 };
 
 #endif // ELAGRAPHICSLINEITEM_H
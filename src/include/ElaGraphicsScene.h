@@ -19,6 +19,7 @@ class ELA_EXPORT ElaGraphicsScene : public QGraphicsScene
     Q_Q_CREATE(ElaGraphicsScene)
     Q_PROPERTY_CREATE_Q_H(bool, IsCheckLinkPort)
     Q_PROPERTY_CREATE_Q_H(QString, SerializePath)
+    Q_PROPERTY_CREATE_Q_H(int, DeserializeBatchMsec)
 public:
     explicit ElaGraphicsScene(QObject* parent = nullptr);
     ~ElaGraphicsScene();
@@ -27,6 +28,15 @@ public:
     void removeSelectedItems();
     void clear();
 
+    // 批量操作 索引与重绘在批次结束后统一处理
+    void addItems(const QList<ElaGraphicsItem*>& itemList);
+    void removeItems(const QList<ElaGraphicsItem*>& itemList);
+
+    void setItemIndexMode(ElaGraphicsSceneType::ItemIndexMode mode);
+    ElaGraphicsSceneType::ItemIndexMode getItemIndexMode() const;
+    void setGridIndexCellSize(int cellSize);
+    int getGridIndexCellSize() const;
+
     QList<ElaGraphicsItem*> createAndAddItem(int width, int height, int count = 1);
     QList<ElaGraphicsItem*> getSelectedElaItems() const;
     QList<ElaGraphicsItem*> getElaItems();
@@ -40,22 +50,37 @@ public:
 
     void selectAllItems();
 
+    // 按连接顺序返回
     QList<QVariantMap> getItemLinkList() const;
     bool addItemLink(ElaGraphicsItem* item1, ElaGraphicsItem* item2, int port1 = 0, int port2 = 0);
     bool removeItemLink(ElaGraphicsItem* item1);
     bool removeItemLink(ElaGraphicsItem* item1, ElaGraphicsItem* item2, int port1 = 0, int port2 = 0);
 
+    // 图查询 基于(图元, 端口)邻接表 复杂度与度数相关 连线与相邻图元按连接顺序返回
+    int getItemLinkCount(ElaGraphicsItem* item) const;
+    QList<ElaGraphicsItem*> getLinkedItems(ElaGraphicsItem* item, int port = -1) const;
+    bool isItemLinked(ElaGraphicsItem* item1, ElaGraphicsItem* item2) const;
+    QList<ElaGraphicsItem*> getConnectedItems(ElaGraphicsItem* item) const;
+    QList<QList<ElaGraphicsItem*>> getConnectedComponents() const;
+
     QVector<QVariantMap> getItemsDataRoute() const;
 
     // 序列化 反序列化
     void serialize();
     void deserialize();
+    // 异步反序列化 工作线程解析文件 GUI线程按DeserializeBatchMsec分批创建图元 期间场景可交互
+    void deserializeAsync();
+    // 取消时撤销本次已创建的图元
+    void cancelDeserialize();
+    bool getIsDeserializing() const;
 
 Q_SIGNALS:
     void showItemLink();
     void mouseLeftClickedItem(ElaGraphicsItem* item);
     void mouseRightClickedItem(ElaGraphicsItem* item);
     void mouseDoubleClickedItem(ElaGraphicsItem* item);
+    void deserializeProgress(int loadedCount, int totalCount);
+    void deserializeFinished(bool isSuccess);
 
 protected:
     virtual void focusOutEvent(QFocusEvent* event) override;
@@ -65,6 +90,9 @@ protected:
     virtual void mouseReleaseEvent(QGraphicsSceneMouseEvent* event) override;
     virtual void mouseMoveEvent(QGraphicsSceneMouseEvent* event) override;
     virtual void mouseDoubleClickEvent(QGraphicsSceneMouseEvent* event) override;
+
+private:
+    friend class ElaGraphicsItemPrivate;
 };
 
 #endif // ELAGRAPHICSSCENE_H
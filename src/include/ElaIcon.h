@@ -5,8 +5,10 @@
 #include "Def.h"
 #include "singleton.h"
 #include "stdafx.h"
+class ElaIconPrivate;
 class ELA_EXPORT ElaIcon
 {
+    Q_Q_CREATE(ElaIcon)
     Q_SINGLETON_CREATE_H(ElaIcon)
 private:
     explicit ElaIcon();
@@ -19,6 +21,16 @@ public:
     QIcon getElaIcon(ElaIconType::IconName awesome, int pixelSize, QColor iconColor);
     QIcon getElaIcon(ElaIconType::IconName awesome, int pixelSize, int fixedWidth, int fixedHeight);
     QIcon getElaIcon(ElaIconType::IconName awesome, int pixelSize, int fixedWidth, int fixedHeight, QColor iconColor);
+    // devicePixelRatio小于等于0时使用应用程序的设备像素比
+    QPixmap getElaIconPixmap(ElaIconType::IconName awesome, int pixelSize, int fixedWidth, int fixedHeight, QColor iconColor = Qt::black, qreal devicePixelRatio = 0);
+
+    // 图标按(图标, 尺寸, 颜色, 设备像素比)缓存 仅限GUI线程调用
+    void setMaxCacheCost(int maxCacheCost);
+    int getMaxCacheCost() const;
+    int getCacheCount() const;
+    int getCacheHitCount() const;
+    int getCacheMissCount() const;
+    void clearCache();
 };
 
 #endif // ELAICON_H
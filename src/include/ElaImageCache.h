@@ -0,0 +1,37 @@
+#ifndef ELAIMAGECACHE_H
+#define ELAIMAGECACHE_H
+
+#include <QImage>
+#include <QObject>
+#include <QPixmap>
+
+#include "singleton.h"
+#include "stdafx.h"
+
+#define eImageCache ElaImageCache::getInstance()
+class ElaImageCachePrivate;
+class ELA_EXPORT ElaImageCache : public QObject
+{
+    Q_OBJECT
+    Q_Q_CREATE(ElaImageCache)
+    Q_SINGLETON_CREATE_H(ElaImageCache)
+private:
+    explicit ElaImageCache(QObject* parent = nullptr);
+    ~ElaImageCache();
+
+public:
+    // 已解码图片按(路径, 尺寸)缓存 返回隐式共享副本 可在任意线程调用
+    QImage getImage(const QString& imagePath, QSize imageSize = QSize());
+    // 转换为设备像素格式的QPixmap 仅限GUI线程调用
+    QPixmap getPixmap(const QString& imagePath, QSize pixmapSize = QSize(), qreal devicePixelRatio = 1.0);
+    void removeImage(const QString& imagePath);
+    void clear();
+
+    // 单位KB
+    void setMaxCacheCost(int maxCacheCost);
+    int getMaxCacheCost() const;
+    int getCacheHitCount() const;
+    int getCacheMissCount() const;
+};
+
+#endif // ELAIMAGECACHE_H
@@ -17,10 +17,16 @@ public:
     static void warning(ElaMessageBarType::PositionPolicy policy, QString title, QString text, int displayMsec, QWidget* parent = nullptr);
     static void information(ElaMessageBarType::PositionPolicy policy, QString title, QString text, int displayMsec, QWidget* parent = nullptr);
     static void error(ElaMessageBarType::PositionPolicy policy, QString title, QString text, int displayMsec, QWidget* parent = nullptr);
+    // 线程安全 同一(类型, 策略, 父窗口)的消息在聚合窗口内合并为一条 以最近一条的内容和累计数量显示 parent为空时使用ElaWindow
+    static void post(ElaMessageBarType::MessageMode messageMode, ElaMessageBarType::PositionPolicy policy, QString title, QString text, int displayMsec, QWidget* parent = nullptr);
+    static void setAggregationWindow(int msec);
+    static int getAggregationWindow();
+    // 每个父窗口每种策略同时显示的上限 超出的消息排队 相同消息合并为重复计数
+    static void setMaximumVisibleCount(int count);
+    static int getMaximumVisibleCount();
 
 protected:
     virtual void paintEvent(QPaintEvent* event) override;
-    virtual bool eventFilter(QObject* watched, QEvent* event) override;
 
 private:
     friend class ElaMessageBarManager;
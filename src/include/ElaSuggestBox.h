@@ -7,6 +7,7 @@
 #include "Def.h"
 #include "stdafx.h"
 
+class ElaSuggestProvider;
 class ElaSuggestBoxPrivate;
 class ELA_EXPORT ElaSuggestBox : public QWidget
 {
@@ -14,6 +15,8 @@ class ELA_EXPORT ElaSuggestBox : public QWidget
     Q_Q_CREATE(ElaSuggestBox)
     Q_PROPERTY_CREATE_Q_H(int, BorderRadius)
     Q_PROPERTY_CREATE_Q_H(Qt::CaseSensitivity, CaseSensitivity)
+    Q_PROPERTY_CREATE_Q_H(int, DebounceMsec)
+    Q_PROPERTY_CREATE_Q_H(int, MaxSuggestCount)
 public:
     explicit ElaSuggestBox(QWidget* parent = nullptr);
     ~ElaSuggestBox();
@@ -23,6 +26,11 @@ public:
     void addSuggestion(ElaIconType::IconName icon, const QString& suggestText, const QVariantMap& suggestData = {});
     void removeSuggestion(const QString& suggestText);
     void removeSuggestion(int index);
+
+    // 设置数据源后改为异步查询 数据源需在ElaSuggestBox析构或重新设置前保持有效
+    void setSuggestProvider(ElaSuggestProvider* provider);
+    ElaSuggestProvider* getSuggestProvider() const;
+    void clearSuggestCache();
 Q_SIGNALS:
     Q_SIGNAL void suggestionClicked(QString suggestText, QVariantMap suggestData);
 };
@@ -0,0 +1,38 @@
+#ifndef ELASUGGESTPROVIDER_H
+#define ELASUGGESTPROVIDER_H
+
+#include <QMetaType>
+#include <QObject>
+#include <QVariantMap>
+#include <QVector>
+
+#include "Def.h"
+#include "stdafx.h"
+
+struct ElaSuggestResult
+{
+    ElaIconType::IconName icon{ElaIconType::None};
+    QString suggestText;
+    QVariantMap suggestData;
+};
+Q_DECLARE_METATYPE(ElaSuggestResult);
+
+// 建议数据源 querySuggestion在ElaSuggestBox的工作线程中调用 实现需保证线程安全
+class ELA_EXPORT ElaSuggestProvider : public QObject
+{
+    Q_OBJECT
+public:
+    explicit ElaSuggestProvider(QObject* parent = nullptr);
+    ~ElaSuggestProvider();
+
+    // 返回数量不超过maxCount 耗时查询应周期性检查isQueryCanceled()并提前返回
+    virtual QVector<ElaSuggestResult> querySuggestion(const QString& queryText, Qt::CaseSensitivity caseSensitivity, int maxCount) = 0;
+    // 缓存细化使用 前缀查询的完整结果经此过滤即可得到更长查询的结果 匹配规则不同于包含时需重写
+    virtual bool isSuggestionMatched(const ElaSuggestResult& suggestion, const QString& queryText, Qt::CaseSensitivity caseSensitivity) const;
+
+protected:
+    // 仅在querySuggestion内有效 当前查询已被更新的输入取代时返回true
+    bool isQueryCanceled() const;
+};
+
+#endif // ELASUGGESTPROVIDER_H
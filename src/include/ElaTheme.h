@@ -4,11 +4,14 @@
 #include <QObject>
 
 #include "Def.h"
+#include "ElaThemePalette.h"
 #include "singleton.h"
 #include "stdafx.h"
 
 #define eTheme ElaTheme::getInstance()
-#define ElaThemeColor(themeMode, themeColor) eTheme->getThemeColor(themeMode, ElaThemeType::themeColor)
+// 直接读取调色板快照 不经过单例加锁
+#define ElaThemeColor(themeMode, themeColor) ElaThemePalette::getThemePalette(themeMode)->getThemeColor(ElaThemeType::themeColor)
+#define ElaThemeCurrentColor(themeColor) ElaThemePalette::getThemePalette()->getThemeColor(ElaThemeType::themeColor)
 class QPainter;
 class ElaThemePrivate;
 class ELA_EXPORT ElaTheme : public QObject
@@ -28,6 +31,8 @@ public:
 
     void setThemeColor(ElaThemeType::ThemeMode themeMode, ElaThemeType::ThemeColor themeColor, QColor newColor);
     const QColor& getThemeColor(ElaThemeType::ThemeMode themeMode, ElaThemeType::ThemeColor themeColor);
+    const ElaThemePalette* getThemePalette() const;
+    const ElaThemePalette* getThemePalette(ElaThemeType::ThemeMode themeMode) const;
 Q_SIGNALS:
     Q_SIGNAL void themeModeChanged(ElaThemeType::ThemeMode themeMode);
 };
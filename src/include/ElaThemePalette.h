@@ -0,0 +1,43 @@
+#ifndef ELATHEMEPALETTE_H
+#define ELATHEMEPALETTE_H
+
+#include <QAtomicPointer>
+#include <QColor>
+
+#include "Def.h"
+#include "stdafx.h"
+
+// 不可变的主题颜色快照 由ElaTheme创建 修改颜色时替换为新的快照
+// 读取的指针在同一主题的快照再次被替换前有效 不应长期保存 需要时重新读取
+class ELA_EXPORT ElaThemePalette
+{
+public:
+    static constexpr int ThemeColorCount = ElaThemeType::StatusDanger + 1;
+    ElaThemePalette(ElaThemeType::ThemeMode themeMode, const QColor* colorList);
+    ~ElaThemePalette();
+
+    ElaThemeType::ThemeMode getThemeMode() const
+    {
+        return _themeMode;
+    }
+    // 按值返回 ElaThemeColor宏的结果不依赖快照的生命周期
+    QColor getThemeColor(ElaThemeType::ThemeColor themeColor) const
+    {
+        return _colorList[themeColor];
+    }
+
+    // 无锁读取 当前主题或指定主题的快照
+    static const ElaThemePalette* getThemePalette();
+    static const ElaThemePalette* getThemePalette(ElaThemeType::ThemeMode themeMode);
+
+private:
+    friend class ElaThemePrivate;
+    ElaThemeType::ThemeMode _themeMode;
+    QColor _colorList[ThemeColorCount];
+    static QAtomicPointer<const ElaThemePalette> _currentPalette;
+    static QAtomicPointer<const ElaThemePalette> _lightPalette;
+    static QAtomicPointer<const ElaThemePalette> _darkPalette;
+    Q_DISABLE_COPY(ElaThemePalette)
+};
+
+#endif // ELATHEMEPALETTE_H
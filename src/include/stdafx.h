@@ -9,6 +9,13 @@
 #define ELA_EXPORT Q_DECL_IMPORT
 #endif
 
+// 内部控件仅在构建基准程序时导出 供基准程序直接测量
+#ifdef ELAWIDGETTOOLS_BUILD_BENCHMARK
+#define ELA_BENCHMARK_EXPORT ELA_EXPORT
+#else
+#define ELA_BENCHMARK_EXPORT
+#endif
+
 #define Q_PROPERTY_CREATE(TYPE, M)                          \
     Q_PROPERTY(TYPE p##M MEMBER _p##M NOTIFY p##M##Changed) \
 public:                                                     \
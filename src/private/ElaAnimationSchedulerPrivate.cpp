@@ -0,0 +1,159 @@
+#include "ElaAnimationSchedulerPrivate.h"
+
+#include <QElapsedTimer>
+
+#include "ElaApplication.h"
+ElaAnimationDriver::ElaAnimationDriver(ElaAnimationSchedulerPrivate* schedulerPrivate)
+    : QAbstractAnimation{nullptr}, _schedulerPrivate(schedulerPrivate)
+{
+}
+
+ElaAnimationDriver::~ElaAnimationDriver()
+{
+}
+
+int ElaAnimationDriver::duration() const
+{
+    return -1;
+}
+
+void ElaAnimationDriver::updateCurrentTime(int currentTime)
+{
+    _schedulerPrivate->_onFrame(currentTime);
+}
+
+ElaAnimationSchedulerPrivate::ElaAnimationSchedulerPrivate(QObject* parent)
+    : QObject{parent}
+{
+}
+
+ElaAnimationSchedulerPrivate::~ElaAnimationSchedulerPrivate()
+{
+}
+
+void ElaAnimationSchedulerPrivate::onAnimationPolicyChanged()
+{
+    if (eApp->getAnimationPolicy() != ElaApplicationType::Off || _activeIndexVector.isEmpty())
+    {
+        return;
+    }
+    // 切换为关闭时 进行中的动画立即推进到终值
+    for (int recordIndex : std::as_const(_activeIndexVector))
+    {
+        _recordVector[recordIndex].duration = 0;
+    }
+    _onFrame(_driver->currentTime());
+}
+
+int ElaAnimationSchedulerPrivate::_acquireRecord()
+{
+    if (!_freeIndexVector.isEmpty())
+    {
+        return _freeIndexVector.takeLast();
+    }
+    _recordVector.append(ElaAnimationRecord());
+    return _recordVector.count() - 1;
+}
+
+void ElaAnimationSchedulerPrivate::_releaseRecord(int activeIndex)
+{
+    int recordIndex = _activeIndexVector[activeIndex];
+    ElaAnimationRecord& record = _recordVector[recordIndex];
+    record.isActive = false;
+    record.generation++;
+    record.target = nullptr;
+    record.animationKey = nullptr;
+    record.valueSetter = nullptr;
+    record.updateWidget = nullptr;
+    record.finishedCallback = nullptr;
+    _activeIndexVector[activeIndex] = _activeIndexVector.last();
+    _activeIndexVector.removeLast();
+    _freeIndexVector.append(recordIndex);
+}
+
+int ElaAnimationSchedulerPrivate::_findActiveIndex(quint64 animationID) const
+{
+    int recordIndex = static_cast<int>(animationID & 0xFFFFFFFF);
+    quint32 generation = static_cast<quint32>(animationID >> 32);
+    if (recordIndex >= _recordVector.count())
+    {
+        return -1;
+    }
+    const ElaAnimationRecord& record = _recordVector[recordIndex];
+    if (!record.isActive || record.generation != generation)
+    {
+        return -1;
+    }
+    return _activeIndexVector.indexOf(recordIndex);
+}
+
+int ElaAnimationSchedulerPrivate::_findActiveIndex(QObject* target, const char* animationKey) const
+{
+    for (int i = 0; i < _activeIndexVector.count(); i++)
+    {
+        const ElaAnimationRecord& record = _recordVector[_activeIndexVector[i]];
+        if (record.target == target && record.animationKey && qstrcmp(record.animationKey, animationKey) == 0)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void ElaAnimationSchedulerPrivate::_onFrame(int currentTime)
+{
+    Q_Q(ElaAnimationScheduler);
+    QElapsedTimer frameTimer;
+    frameTimer.start();
+    // 逆序遍历 释放记录时的尾部交换不会跳过未处理项
+    for (int i = _activeIndexVector.count() - 1; i >= 0; i--)
+    {
+        if (i >= _activeIndexVector.count())
+        {
+            continue;
+        }
+        ElaAnimationRecord& record = _recordVector[_activeIndexVector[i]];
+        if (!record.target)
+        {
+            _releaseRecord(i);
+            continue;
+        }
+        qreal progress = record.duration == 0 ? 1 : qBound(0.0, static_cast<qreal>(currentTime - record.startTime) / record.duration, 1.0);
+        qreal value = record.startValue + (record.endValue - record.startValue) * record.easingCurve.valueForProgress(progress);
+        record.valueSetter(value);
+        ElaAnimationRecord& currentRecord = _recordVector[_activeIndexVector[i]];
+        if (currentRecord.updateWidget)
+        {
+            _updateWidgetSet.insert(currentRecord.updateWidget);
+        }
+        if (progress >= 1)
+        {
+            if (currentRecord.finishedCallback)
+            {
+                _finishedCallbackVector.append(std::move(currentRecord.finishedCallback));
+            }
+            _releaseRecord(i);
+        }
+    }
+    // 同一控件在本帧只刷新一次
+    for (QWidget* widget : std::as_const(_updateWidgetSet))
+    {
+        widget->update();
+    }
+    _updateWidgetSet.clear();
+    if (_activeIndexVector.isEmpty())
+    {
+        _driver->stop();
+    }
+    _frameCount++;
+    _lastFrameCostNsec = frameTimer.nsecsElapsed();
+    _totalFrameCostNsec += _lastFrameCostNsec;
+    // 结束回调可能启动新动画 放到本帧统计之后执行
+    QVector<ElaAnimationScheduler::FinishedCallback> finishedCallbackVector;
+    finishedCallbackVector.swap(_finishedCallbackVector);
+    for (const auto& finishedCallback : std::as_const(finishedCallbackVector))
+    {
+        finishedCallback();
+    }
+    Q_EMIT q->frameFinished(_activeIndexVector.count(), _lastFrameCostNsec);
+}
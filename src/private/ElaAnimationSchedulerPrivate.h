@@ -0,0 +1,73 @@
+#ifndef ELAANIMATIONSCHEDULERPRIVATE_H
+#define ELAANIMATIONSCHEDULERPRIVATE_H
+
+#include <QAbstractAnimation>
+#include <QEasingCurve>
+#include <QObject>
+#include <QPointer>
+#include <QSet>
+#include <QVector>
+#include <QWidget>
+
+#include "ElaAnimationScheduler.h"
+#include "stdafx.h"
+class ElaAnimationSchedulerPrivate;
+// 挂载在Qt统一动画计时器上的常驻帧驱动
+class ElaAnimationDriver : public QAbstractAnimation
+{
+public:
+    explicit ElaAnimationDriver(ElaAnimationSchedulerPrivate* schedulerPrivate);
+    ~ElaAnimationDriver();
+    int duration() const override;
+
+protected:
+    void updateCurrentTime(int currentTime) override;
+
+private:
+    ElaAnimationSchedulerPrivate* _schedulerPrivate{nullptr};
+};
+
+struct ElaAnimationRecord
+{
+    quint32 generation{1};
+    bool isActive{false};
+    QPointer<QObject> target;
+    const char* animationKey{nullptr};
+    qreal startValue{0};
+    qreal endValue{0};
+    int duration{0};
+    int startTime{0};
+    QEasingCurve easingCurve;
+    ElaAnimationScheduler::ValueSetter valueSetter;
+    QPointer<QWidget> updateWidget;
+    ElaAnimationScheduler::FinishedCallback finishedCallback;
+};
+
+class ElaAnimationSchedulerPrivate : public QObject
+{
+    Q_OBJECT
+    Q_D_CREATE(ElaAnimationScheduler)
+public:
+    explicit ElaAnimationSchedulerPrivate(QObject* parent = nullptr);
+    ~ElaAnimationSchedulerPrivate();
+    Q_SLOT void onAnimationPolicyChanged();
+
+private:
+    friend class ElaAnimationDriver;
+    ElaAnimationDriver* _driver{nullptr};
+    QVector<ElaAnimationRecord> _recordVector;
+    QVector<int> _freeIndexVector;
+    QVector<int> _activeIndexVector;
+    QVector<ElaAnimationScheduler::FinishedCallback> _finishedCallbackVector;
+    QSet<QWidget*> _updateWidgetSet;
+    quint64 _frameCount{0};
+    qint64 _lastFrameCostNsec{0};
+    qint64 _totalFrameCostNsec{0};
+    int _acquireRecord();
+    void _releaseRecord(int activeIndex);
+    int _findActiveIndex(quint64 animationID) const;
+    int _findActiveIndex(QObject* target, const char* animationKey) const;
+    void _onFrame(int currentTime);
+};
+
+#endif // ELAANIMATIONSCHEDULERPRIVATE_H
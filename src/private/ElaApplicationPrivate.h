@@ -13,6 +13,7 @@ class ElaApplicationPrivate : public QObject
     Q_D_CREATE(ElaApplication)
     Q_PROPERTY_CREATE_D(bool, IsEnableMica)
     Q_PROPERTY_CREATE_D(QString, MicaImagePath)
+    Q_PROPERTY_CREATE_D(ElaApplicationType::AnimationPolicy, AnimationPolicy)
 public:
     explicit ElaApplicationPrivate(QObject* parent = nullptr);
     ~ElaApplicationPrivate();
@@ -26,6 +27,7 @@ protected:
 private:
     friend class ElaMicaBaseInitObject;
     ElaThemeType::ThemeMode _themeMode;
+    int _reducedCrossfadeDuration{150};
     QList<QWidget*> _micaWidgetList;
     QImage _lightBaseImage;
     QImage _darkBaseImage;
@@ -3,6 +3,7 @@
 #include <QDate>
 #include <QPropertyAnimation>
 
+#include "ElaApplication.h"
 #include "ElaCalendar.h"
 #include "ElaCalendarPicker.h"
 #include "ElaCalendarPickerContainer.h"
@@ -21,7 +22,7 @@ void ElaCalendarPickerPrivate::onCalendarPickerClicked()
     QPoint endPoint(q->mapToGlobal(QPoint((q->width() - _calendarPickerContainer->width()) / 2, q->height() + 5)));
     QPropertyAnimation* showAnimation = new QPropertyAnimation(_calendarPickerContainer, "pos");
     showAnimation->setEasingCurve(QEasingCurve::OutCubic);
-    showAnimation->setDuration(250);
+    showAnimation->setDuration(eApp->getAnimationDuration(250));
     showAnimation->setStartValue(QPoint(endPoint.x(), endPoint.y() - 10));
     showAnimation->setEndValue(endPoint);
     _calendarPickerContainer->show();
@@ -1,13 +1,15 @@
 #include "ElaCalendarPrivate.h"
 
-#include <QApplication>
+#include <QLayout>
 #include <QPropertyAnimation>
 #include <QScrollBar>
 
+#include "ElaApplication.h"
 #include "ElaBaseListView.h"
 #include "ElaCalendar.h"
 #include "ElaCalendarDelegate.h"
 #include "ElaCalendarModel.h"
+#include "ElaSnapshotCache.h"
 #include "ElaToolButton.h"
 ElaCalendarPrivate::ElaCalendarPrivate(QObject* parent)
     : QObject{parent}
@@ -30,21 +32,22 @@ void ElaCalendarPrivate::onSwitchButtonClicked()
     ElaCalendarType displayMode = _calendarModel->getDisplayMode();
     if (displayMode == ElaCalendarType::DayMode)
     {
-        _oldCalendarViewPix = q->grab(QRect(_borderWidth, _borderWidth + 45, q->width() - 2 * _borderWidth, q->height() - 2 * _borderWidth - 45));
+        _oldCalendarViewPix = eSnapshotCache->renderSnapshot(q, QRect(_borderWidth, _borderWidth + 45, q->width() - 2 * _borderWidth, q->height() - 2 * _borderWidth - 45), "OldCalendarView");
         _calendarModel->setDisplayMode(ElaCalendarType::MonthMode);
         _calendarTitleView->setVisible(false);
-        QApplication::processEvents();
         _calendarView->setSpacing(15);
+        _updateCalendarViewLayout();
         _scrollToDate(_pSelectedDate.isValid() ? _pSelectedDate : QDate::currentDate());
-        _newCalendarViewPix = q->grab(QRect(_borderWidth, _borderWidth + 45, q->width() - 2 * _borderWidth, q->height() - 2 * _borderWidth - 45));
+        _newCalendarViewPix = eSnapshotCache->renderSnapshot(q, QRect(_borderWidth, _borderWidth + 45, q->width() - 2 * _borderWidth, q->height() - 2 * _borderWidth - 45), "NewCalendarView");
         _doSwitchAnimation(false);
     }
     else if (displayMode == ElaCalendarType::MonthMode)
     {
-        _oldCalendarViewPix = q->grab(QRect(_borderWidth, _borderWidth + 45, q->width() - 2 * _borderWidth, q->height() - 2 * _borderWidth - 45));
+        _oldCalendarViewPix = eSnapshotCache->renderSnapshot(q, QRect(_borderWidth, _borderWidth + 45, q->width() - 2 * _borderWidth, q->height() - 2 * _borderWidth - 45), "OldCalendarView");
         _calendarModel->setDisplayMode(ElaCalendarType::YearMode);
+        _updateCalendarViewLayout();
         _scrollToDate(_pSelectedDate.isValid() ? _pSelectedDate : QDate::currentDate());
-        _newCalendarViewPix = q->grab(QRect(_borderWidth, _borderWidth + 45, q->width() - 2 * _borderWidth, q->height() - 2 * _borderWidth - 45));
+        _newCalendarViewPix = eSnapshotCache->renderSnapshot(q, QRect(_borderWidth, _borderWidth + 45, q->width() - 2 * _borderWidth, q->height() - 2 * _borderWidth - 45), "NewCalendarView");
         _doSwitchAnimation(false);
     }
 }
@@ -60,24 +63,26 @@ void ElaCalendarPrivate::onCalendarViewClicked(const QModelIndex& index)
     {
     case YearMode:
     {
-        _oldCalendarViewPix = q->grab(QRect(_borderWidth, _borderWidth + 45, q->width() - 2 * _borderWidth, q->height() - 2 * _borderWidth - 45));
+        _oldCalendarViewPix = eSnapshotCache->renderSnapshot(q, QRect(_borderWidth, _borderWidth + 45, q->width() - 2 * _borderWidth, q->height() - 2 * _borderWidth - 45), "OldCalendarView");
         _lastSelectedYear = _calendarModel->getMinimumDate().year() + index.row();
         _calendarModel->setDisplayMode(ElaCalendarType::MonthMode);
+        _updateCalendarViewLayout();
         _scrollToDate(QDate(_lastSelectedYear, _lastSelectedMonth, 15));
-        _newCalendarViewPix = q->grab(QRect(_borderWidth, _borderWidth + 45, q->width() - 2 * _borderWidth, q->height() - 2 * _borderWidth - 45));
+        _newCalendarViewPix = eSnapshotCache->renderSnapshot(q, QRect(_borderWidth, _borderWidth + 45, q->width() - 2 * _borderWidth, q->height() - 2 * _borderWidth - 45), "NewCalendarView");
         _doSwitchAnimation(true);
         break;
     }
     case MonthMode:
     {
-        _oldCalendarViewPix = q->grab(QRect(_borderWidth, _borderWidth + 45, q->width() - 2 * _borderWidth, q->height() - 2 * _borderWidth - 45));
+        _oldCalendarViewPix = eSnapshotCache->renderSnapshot(q, QRect(_borderWidth, _borderWidth + 45, q->width() - 2 * _borderWidth, q->height() - 2 * _borderWidth - 45), "OldCalendarView");
         _lastSelectedMonth = index.row() % 12 + 1;
         _calendarModel->setDisplayMode(ElaCalendarType::DayMode);
         _calendarTitleView->setVisible(true);
         _calendarView->setSpacing(0);
+        _updateCalendarViewLayout();
         _scrollToDate(QDate(_lastSelectedYear, _lastSelectedMonth, 15));
         _calendarView->selectionModel()->setCurrentIndex(_calendarModel->getIndexFromDate(_pSelectedDate), QItemSelectionModel::Select);
-        _newCalendarViewPix = q->grab(QRect(_borderWidth, _borderWidth + 45, q->width() - 2 * _borderWidth, q->height() - 2 * _borderWidth - 45));
+        _newCalendarViewPix = eSnapshotCache->renderSnapshot(q, QRect(_borderWidth, _borderWidth + 45, q->width() - 2 * _borderWidth, q->height() - 2 * _borderWidth - 45), "NewCalendarView");
         _calendarTitleView->setVisible(false);
         _doSwitchAnimation(true);
         break;
@@ -101,7 +106,7 @@ void ElaCalendarPrivate::onUpButtonClicked()
     QScrollBar* vscrollBar = _calendarView->verticalScrollBar();
     QPropertyAnimation* scrollAnimation = new QPropertyAnimation(vscrollBar, "value");
     scrollAnimation->setEasingCurve(QEasingCurve::OutSine);
-    scrollAnimation->setDuration(300);
+    scrollAnimation->setDuration(eApp->getAnimationDuration(300));
     scrollAnimation->setStartValue(vscrollBar->value());
     scrollAnimation->setEndValue(vscrollBar->value() - 150);
     scrollAnimation->start(QAbstractAnimation::DeleteWhenStopped);
@@ -112,7 +117,7 @@ void ElaCalendarPrivate::onDownButtonClicked()
     QScrollBar* vscrollBar = _calendarView->verticalScrollBar();
     QPropertyAnimation* scrollAnimation = new QPropertyAnimation(vscrollBar, "value");
     scrollAnimation->setEasingCurve(QEasingCurve::OutSine);
-    scrollAnimation->setDuration(300);
+    scrollAnimation->setDuration(eApp->getAnimationDuration(300));
     scrollAnimation->setStartValue(vscrollBar->value());
     scrollAnimation->setEndValue(vscrollBar->value() + 150);
     scrollAnimation->start(QAbstractAnimation::DeleteWhenStopped);
@@ -137,6 +142,14 @@ void ElaCalendarPrivate::_scrollToDate(QDate date)
     }
 }
 
+void ElaCalendarPrivate::_updateCalendarViewLayout()
+{
+    Q_Q(ElaCalendar);
+    // 同步完成布局与视图项排布 截图前无需再进入事件循环
+    q->layout()->activate();
+    _calendarView->doItemsLayout();
+}
+
 void ElaCalendarPrivate::_doSwitchAnimation(bool isZoomIn)
 {
     Q_Q(ElaCalendar);
@@ -164,6 +177,10 @@ void ElaCalendarPrivate::_doSwitchAnimation(bool isZoomIn)
             }
             _isSwitchAnimationFinished = true;
             _calendarDelegate->setIsTransparent(false);
+            // 释放快照副本后归还缓冲池 由池容量上限约束
+            _oldCalendarViewPix = QPixmap();
+            _newCalendarViewPix = QPixmap();
+            eSnapshotCache->releaseSnapshot(q);
         });
         if (isZoomIn)
         {
@@ -176,7 +193,7 @@ void ElaCalendarPrivate::_doSwitchAnimation(bool isZoomIn)
             newPixZoomAnimation->setStartValue(1.5);
             newPixZoomAnimation->setEndValue(1);
         }
-        newPixZoomAnimation->setDuration(300);
+        newPixZoomAnimation->setDuration(eApp->getAnimationDuration(300));
         newPixZoomAnimation->setEasingCurve(QEasingCurve::OutCubic);
         newPixZoomAnimation->start(QAbstractAnimation::DeleteWhenStopped);
     });
@@ -192,20 +209,20 @@ void ElaCalendarPrivate::_doSwitchAnimation(bool isZoomIn)
         oldPixZoomAnimation->setStartValue(1);
         oldPixZoomAnimation->setEndValue(0.85);
     }
-    oldPixZoomAnimation->setDuration(150);
-    oldPixZoomAnimation->start(QAbstractAnimation::DeleteWhenStopped);
-
     QPropertyAnimation* oldPixOpacityAnimation = new QPropertyAnimation(this, "pPixOpacity");
     connect(oldPixZoomAnimation, &QPropertyAnimation::finished, this, [=]() {
         QPropertyAnimation* newPixOpacityAnimation = new QPropertyAnimation(this, "pPixOpacity");
         newPixOpacityAnimation->setStartValue(0);
         newPixOpacityAnimation->setEndValue(1);
-        newPixOpacityAnimation->setDuration(300);
+        newPixOpacityAnimation->setDuration(eApp->getAnimationDuration(300, true));
         newPixOpacityAnimation->start(QAbstractAnimation::DeleteWhenStopped);
     });
+    // 时长为0时start()会同步触发finished并删除动画 需在全部连接完成后启动
+    oldPixZoomAnimation->setDuration(eApp->getAnimationDuration(150));
+    oldPixZoomAnimation->start(QAbstractAnimation::DeleteWhenStopped);
     oldPixOpacityAnimation->setStartValue(1);
     oldPixOpacityAnimation->setEndValue(0);
-    oldPixOpacityAnimation->setDuration(150);
+    oldPixOpacityAnimation->setDuration(eApp->getAnimationDuration(150, true));
     oldPixOpacityAnimation->start(QAbstractAnimation::DeleteWhenStopped);
 }
 
@@ -44,6 +44,7 @@ private:
     bool _isSwitchAnimationFinished{true};
     bool _isDrawNewPix{false};
     void _scrollToDate(QDate date);
+    void _updateCalendarViewLayout();
     void _doSwitchAnimation(bool isZoomIn);
     void _updateSwitchButtonText();
 };
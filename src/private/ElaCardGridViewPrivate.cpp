@@ -0,0 +1,88 @@
+#include "ElaCardGridViewPrivate.h"
+
+#include <QScrollBar>
+
+#include "ElaCardGridView.h"
+ElaCardGridViewPrivate::ElaCardGridViewPrivate(QObject* parent)
+    : QObject{parent}
+{
+}
+
+ElaCardGridViewPrivate::~ElaCardGridViewPrivate()
+{
+}
+
+int ElaCardGridViewPrivate::_getItemCount() const
+{
+    Q_Q(const ElaCardGridView);
+    if (!q->model())
+    {
+        return 0;
+    }
+    return q->model()->rowCount(q->rootIndex());
+}
+
+int ElaCardGridViewPrivate::_getColumnCount() const
+{
+    Q_Q(const ElaCardGridView);
+    int stepX = _pItemSize.width() + _pItemSpacing;
+    return qMax(1, (q->viewport()->width() - 2 * _viewMargin + _pItemSpacing) / stepX);
+}
+
+int ElaCardGridViewPrivate::_getLineCount() const
+{
+    int columnCount = _getColumnCount();
+    return (_getItemCount() + columnCount - 1) / columnCount;
+}
+
+QRect ElaCardGridViewPrivate::_getItemRect(int row) const
+{
+    int columnCount = _getColumnCount();
+    int line = row / columnCount;
+    int column = row % columnCount;
+    return QRect(_viewMargin + column * (_pItemSize.width() + _pItemSpacing), _viewMargin + line * (_pItemSize.height() + _pItemSpacing), _pItemSize.width(), _pItemSize.height());
+}
+
+bool ElaCardGridViewPrivate::_getLineRange(const QRect& contentRect, int& firstLine, int& lastLine) const
+{
+    int lineCount = _getLineCount();
+    int stepY = _pItemSize.height() + _pItemSpacing;
+    if (lineCount == 0 || contentRect.bottom() < _viewMargin)
+    {
+        return false;
+    }
+    firstLine = qMax(0, (contentRect.top() - _viewMargin) / stepY);
+    lastLine = qMin(lineCount - 1, (contentRect.bottom() - _viewMargin) / stepY);
+    return firstLine <= lastLine;
+}
+
+void ElaCardGridViewPrivate::_updateHoverIndex(const QModelIndex& index)
+{
+    Q_Q(ElaCardGridView);
+    if (_hoverIndex == index)
+    {
+        return;
+    }
+    if (_hoverIndex.isValid())
+    {
+        q->viewport()->update(q->visualRect(_hoverIndex));
+    }
+    _hoverIndex = index;
+    if (_hoverIndex.isValid())
+    {
+        q->viewport()->update(q->visualRect(_hoverIndex));
+    }
+}
+
+void ElaCardGridViewPrivate::_updateRubberBand(const QRect& rubberBandRect)
+{
+    Q_Q(ElaCardGridView);
+    if (_rubberBandRect == rubberBandRect)
+    {
+        return;
+    }
+    // 新旧区域并集重绘 略微外扩覆盖边框
+    QRect updateRect = _rubberBandRect.united(rubberBandRect).adjusted(-2, -2, 2, 2);
+    _rubberBandRect = rubberBandRect;
+    q->viewport()->update(updateRect.translated(0, -q->verticalScrollBar()->value()));
+}
@@ -0,0 +1,42 @@
+#ifndef ELACARDGRIDVIEWPRIVATE_H
+#define ELACARDGRIDVIEWPRIVATE_H
+
+#include <QObject>
+#include <QPersistentModelIndex>
+#include <QRect>
+
+#include "Def.h"
+#include "stdafx.h"
+class ElaCardGridView;
+class ElaCardGridDelegate;
+class ElaCardGridViewPrivate : public QObject
+{
+    Q_OBJECT
+    Q_D_CREATE(ElaCardGridView)
+    Q_PROPERTY_CREATE_D(ElaCardGridType::CardMode, CardMode)
+    Q_PROPERTY_CREATE_D(QSize, ItemSize)
+    Q_PROPERTY_CREATE_D(int, ItemSpacing)
+public:
+    explicit ElaCardGridViewPrivate(QObject* parent = nullptr);
+    ~ElaCardGridViewPrivate();
+
+private:
+    ElaCardGridDelegate* _cardGridDelegate{nullptr};
+    QPersistentModelIndex _hoverIndex;
+    // 框选区域 内容坐标
+    QPoint _pressedPos;
+    QRect _rubberBandRect;
+    int _viewMargin{5};
+
+    // 布局由行号直接计算 不保存逐项几何
+    int _getItemCount() const;
+    int _getColumnCount() const;
+    int _getLineCount() const;
+    QRect _getItemRect(int row) const;
+    // 与内容坐标rect相交的行区间 无相交时返回false
+    bool _getLineRange(const QRect& contentRect, int& firstLine, int& lastLine) const;
+    void _updateHoverIndex(const QModelIndex& index);
+    void _updateRubberBand(const QRect& rubberBandRect);
+};
+
+#endif // ELACARDGRIDVIEWPRIVATE_H
@@ -1,8 +1,9 @@
 #include "ElaFlowLayoutPrivate.h"
 
-#include <QPropertyAnimation>
+#include <QSet>
 #include <QWidget>
 
+#include "ElaAnimationScheduler.h"
 #include "ElaFlowLayout.h"
 ElaFlowLayoutPrivate::ElaFlowLayoutPrivate(QObject* parent)
     : QObject{parent}
@@ -13,76 +14,102 @@ ElaFlowLayoutPrivate::~ElaFlowLayoutPrivate()
 {
 }
 
-int ElaFlowLayoutPrivate::_doLayout(const QRect& rect, bool testOnly) const
+int ElaFlowLayoutPrivate::_doLayout(const QRect& rect, bool testOnly)
 {
-    Q_Q(const ElaFlowLayout);
+    Q_Q(ElaFlowLayout);
+    _updateSizeHintCache();
     int left, top, right, bottom;
     q->getContentsMargins(&left, &top, &right, &bottom);
     QRect effectiveRect = rect.adjusted(+left, +top, -right, -bottom);
+    int itemCount = _itemList.count();
+    int startIndex = 0;
     int x = effectiveRect.x();
     int y = effectiveRect.y();
     int lineHeight = 0;
-
-    for (QLayoutItem* item : std::as_const(_itemList))
+    if (testOnly)
+    {
+        if (_testWidth == rect.width())
+        {
+            return _testHeight;
+        }
+    }
+    else
     {
-        const QWidget* wid = item->widget();
-        int spaceX = q->horizontalSpacing();
-        if (spaceX == -1)
+        if (effectiveRect.topLeft() != _layoutRect.topLeft() || effectiveRect.width() != _layoutRect.width())
+        {
+            _layoutRect = effectiveRect;
+            _firstDirtyIndex = 0;
+        }
+        if (_firstDirtyIndex >= itemCount)
         {
-            spaceX = wid->style()->layoutSpacing(QSizePolicy::PushButton, QSizePolicy::PushButton, Qt::Horizontal);
+            return 0;
         }
-        int spaceY = q->verticalSpacing();
-        if (spaceY == -1)
+        // 首个变化项之前的位置不受影响 从其前一项所在行的行首开始重排
+        if (_firstDirtyIndex > 0)
         {
-            spaceY = wid->style()->layoutSpacing(QSizePolicy::PushButton, QSizePolicy::PushButton, Qt::Vertical);
+            startIndex = _firstDirtyIndex - 1;
+            while (startIndex > 0 && _itemPointVector[startIndex - 1].y() == _itemPointVector[startIndex].y())
+            {
+                startIndex--;
+            }
+            y = _itemPointVector[startIndex].y();
         }
+    }
 
-        int nextX = x + item->sizeHint().width() + spaceX;
-        if (nextX - spaceX > effectiveRect.right() && lineHeight > 0)
+    QVector<ElaFlowLayoutMoveData> moveDataVector;
+    QSet<QWidget*> placedWidgetSet;
+    for (int i = startIndex; i < itemCount; i++)
+    {
+        const QSize& sizeHint = _sizeHintVector[i];
+        int nextX = x + sizeHint.width() + _spaceX;
+        if (nextX - _spaceX > effectiveRect.right() && lineHeight > 0)
         {
             x = effectiveRect.x();
-            y = y + lineHeight + spaceY;
-            nextX = x + item->sizeHint().width() + spaceX;
+            y = y + lineHeight + _spaceY;
+            nextX = x + sizeHint.width() + _spaceX;
             lineHeight = 0;
         }
-        if (!_lastGeometryMap.contains(item))
-        {
-            _lastGeometryMap.insert(item, QPoint(x, y));
-        }
         if (!testOnly)
         {
-            if ((item->geometry().x() == 0 && item->geometry().y() == 0))
+            _itemPointVector[i] = QPoint(x, y);
+            QLayoutItem* item = _itemList[i];
+            QRect targetRect(QPoint(x, y), sizeHint);
+            QWidget* widget = item->widget();
+            if (!_isAnimation || !widget || (item->geometry().x() == 0 && item->geometry().y() == 0))
             {
-                item->setGeometry(QRect(QPoint(x, y), item->sizeHint()));
+                item->setGeometry(targetRect);
             }
-            else if (item->geometry().x() != x || item->geometry().y() != y)
+            else if (item->geometry() != targetRect)
             {
-                if (_isAnimation)
-                {
-                    // 阻止多重动画
-                    if (_lastGeometryMap[item] == QPoint(x, y))
-                    {
-                        lineHeight = qMax(lineHeight, item->sizeHint().height());
-                        return y + lineHeight - rect.y() + bottom;
-                    }
-                    QPropertyAnimation* geometryAnimation = new QPropertyAnimation(item->widget(), "geometry");
-                    geometryAnimation->setStartValue(item->widget()->geometry());
-                    geometryAnimation->setEndValue(QRect(QPoint(x, y), item->sizeHint()));
-                    geometryAnimation->setDuration(300);
-                    geometryAnimation->setEasingCurve(QEasingCurve::InOutSine);
-                    geometryAnimation->start(QAbstractAnimation::DeleteWhenStopped);
-                    _lastGeometryMap[item] = QPoint(x, y);
-                }
-                else
-                {
-                    item->setGeometry(QRect(QPoint(x, y), item->sizeHint()));
-                }
+                ElaFlowLayoutMoveData moveData;
+                moveData.widget = widget;
+                moveData.startRect = widget->geometry();
+                moveData.endRect = targetRect;
+                moveDataVector.append(moveData);
+            }
+            if (_isAnimation && widget)
+            {
+                placedWidgetSet.insert(widget);
             }
         }
         x = nextX;
-        lineHeight = qMax(lineHeight, item->sizeHint().height());
+        lineHeight = qMax(lineHeight, sizeHint.height());
+    }
+    int height = y + lineHeight - rect.y() + bottom;
+    if (testOnly)
+    {
+        _testWidth = rect.width();
+        _testHeight = height;
+    }
+    else
+    {
+        _firstDirtyIndex = itemCount;
+        if (_isAnimation)
+        {
+            _startMoveAnimation(moveDataVector, placedWidgetSet);
+        }
     }
-    return y + lineHeight - rect.y() + bottom;
+    return height;
 }
 
 int ElaFlowLayoutPrivate::_smartSpacing(QStyle::PixelMetric pm) const
@@ -103,3 +130,97 @@ int ElaFlowLayoutPrivate::_smartSpacing(QStyle::PixelMetric pm) const
         return static_cast<QLayout*>(parent)->spacing();
     }
 }
+
+void ElaFlowLayoutPrivate::_updateSizeHintCache()
+{
+    Q_Q(ElaFlowLayout);
+    if (_isSizeHintCacheValid)
+    {
+        return;
+    }
+    _isSizeHintCacheValid = true;
+    const QWidget* styleWidget = nullptr;
+    for (auto item : _itemList)
+    {
+        if (item->widget())
+        {
+            styleWidget = item->widget();
+            break;
+        }
+    }
+    int spaceX = q->horizontalSpacing();
+    if (spaceX == -1)
+    {
+        spaceX = styleWidget ? styleWidget->style()->layoutSpacing(QSizePolicy::PushButton, QSizePolicy::PushButton, Qt::Horizontal) : 0;
+    }
+    int spaceY = q->verticalSpacing();
+    if (spaceY == -1)
+    {
+        spaceY = styleWidget ? styleWidget->style()->layoutSpacing(QSizePolicy::PushButton, QSizePolicy::PushButton, Qt::Vertical) : 0;
+    }
+    if (spaceX != _spaceX || spaceY != _spaceY)
+    {
+        _spaceX = spaceX;
+        _spaceY = spaceY;
+        _markDirty(0);
+    }
+    for (int i = 0; i < _itemList.count(); i++)
+    {
+        QSize sizeHint = _itemList[i]->sizeHint();
+        if (sizeHint != _sizeHintVector[i])
+        {
+            _sizeHintVector[i] = sizeHint;
+            _markDirty(i);
+        }
+    }
+}
+
+void ElaFlowLayoutPrivate::_markDirty(int index)
+{
+    _firstDirtyIndex = qMin(_firstDirtyIndex, index);
+    _testWidth = -1;
+}
+
+void ElaFlowLayoutPrivate::_startMoveAnimation(QVector<ElaFlowLayoutMoveData>& moveDataVector, const QSet<QWidget*>& placedWidgetSet)
+{
+    if (moveDataVector.isEmpty())
+    {
+        // 本次已直接就位的控件退出进行中的动画
+        for (int i = _moveDataVector.count() - 1; i >= 0; i--)
+        {
+            if (placedWidgetSet.contains(_moveDataVector[i].widget))
+            {
+                _moveDataVector.remove(i);
+            }
+        }
+        return;
+    }
+    // 未参与本次重排但仍在移动的控件从当前位置继续
+    for (const auto& moveData : std::as_const(_moveDataVector))
+    {
+        if (moveData.widget && !placedWidgetSet.contains(moveData.widget))
+        {
+            ElaFlowLayoutMoveData continueData;
+            continueData.widget = moveData.widget;
+            continueData.startRect = moveData.widget->geometry();
+            continueData.endRect = moveData.endRect;
+            moveDataVector.append(continueData);
+        }
+    }
+    _moveDataVector = moveDataVector;
+    // 每次重排共用一条动画
+    eAnimationScheduler->startAnimation(this, "LayoutGeometry", 0, 1, 300, QEasingCurve::InOutSine, [=](qreal value) {
+        for (const auto& moveData : std::as_const(_moveDataVector))
+        {
+            if (!moveData.widget)
+            {
+                continue;
+            }
+            const QRect& startRect = moveData.startRect;
+            const QRect& endRect = moveData.endRect;
+            moveData.widget->setGeometry(qRound(startRect.x() + (endRect.x() - startRect.x()) * value),
+                                         qRound(startRect.y() + (endRect.y() - startRect.y()) * value),
+                                         qRound(startRect.width() + (endRect.width() - startRect.width()) * value),
+                                         qRound(startRect.height() + (endRect.height() - startRect.height()) * value));
+        } }, nullptr, [=]() { _moveDataVector.clear(); });
+}
@@ -2,11 +2,19 @@
 #define ELAFLOWLAYOUTPRIVATE_H
 
 #include <QLayout>
-#include <QMap>
 #include <QObject>
+#include <QPointer>
 #include <QStyle>
+#include <QVector>
 
 #include "stdafx.h"
+struct ElaFlowLayoutMoveData
+{
+    QPointer<QWidget> widget;
+    QRect startRect;
+    QRect endRect;
+};
+
 class ElaFlowLayout;
 class ElaFlowLayoutPrivate : public QObject
 {
@@ -17,14 +25,27 @@ public:
     ~ElaFlowLayoutPrivate();
 
 private:
-    int _doLayout(const QRect& rect, bool testOnly) const;
+    int _doLayout(const QRect& rect, bool testOnly);
     int _smartSpacing(QStyle::PixelMetric pm) const;
-    mutable QMap<ElaFlowLayout*, int> _lastHeightMap;
-    mutable QMap<QLayoutItem*, QPoint> _lastGeometryMap;
+    void _updateSizeHintCache();
+    void _markDirty(int index);
+    void _startMoveAnimation(QVector<ElaFlowLayoutMoveData>& moveDataVector, const QSet<QWidget*>& placedWidgetSet);
     QList<QLayoutItem*> _itemList;
     bool _isAnimation{false};
     int _hSpacing;
     int _vSpacing;
+
+    // 布局缓存 LayoutRequest时校验尺寸 仅从首个变化项所在行开始重排
+    bool _isSizeHintCacheValid{false};
+    QVector<QSize> _sizeHintVector;
+    QVector<QPoint> _itemPointVector;
+    int _spaceX{0};
+    int _spaceY{0};
+    int _firstDirtyIndex{0};
+    QRect _layoutRect;
+    int _testWidth{-1};
+    int _testHeight{0};
+    QVector<ElaFlowLayoutMoveData> _moveDataVector;
 };
 
 #endif // ELAFLOWLAYOUTPRIVATE_H
@@ -1,5 +1,11 @@
 #include "ElaGraphicsItemPrivate.h"
 
+#include <QPixmapCache>
+
+#include "ElaGraphicsScene.h"
+#include "ElaGraphicsSceneLoader.h"
+#include "ElaGraphicsScenePrivate.h"
+
 ElaGraphicsItemPrivate::ElaGraphicsItemPrivate(QObject* parent)
     : QObject(parent)
 {
@@ -9,13 +15,122 @@ ElaGraphicsItemPrivate::~ElaGraphicsItemPrivate()
 {
 }
 
+void ElaGraphicsItemPrivate::_notifySceneGeometryChanged()
+{
+    Q_Q(ElaGraphicsItem);
+    ElaGraphicsScene* scene = qobject_cast<ElaGraphicsScene*>(q->scene());
+    if (scene)
+    {
+        scene->d_func()->onItemGeometryChanged(q);
+    }
+}
+
+void ElaGraphicsItemPrivate::serializeAttribute(QDataStream& stream) const
+{
+    stream << _itemUID;
+    stream << _pItemName;
+    stream << _pMaxLinkPortCount;
+    stream << _currentLinkPortState;
+    stream << _pDataRoutes;
+}
+
+void ElaGraphicsItemPrivate::deserializeAttribute(QDataStream& stream)
+{
+    ElaGraphicsItemData itemData;
+    itemData.readAttribute(stream);
+    _itemUID = itemData.itemUID;
+    _pItemName = itemData.itemName;
+    _pMaxLinkPortCount = itemData.maxLinkPortCount;
+    _currentLinkPortState = itemData.linkPortState;
+    _pDataRoutes = itemData.dataRoutes;
+}
+
+void ElaGraphicsItemPrivate::applyItemData(const ElaGraphicsItemData& itemData)
+{
+    Q_Q(ElaGraphicsItem);
+    q->setPos(itemData.x, itemData.y);
+    q->setZValue(itemData.z);
+    q->setWidth(itemData.width);
+    q->setHeight(itemData.height);
+    _itemUID = itemData.itemUID;
+    _pItemName = itemData.itemName;
+    _pMaxLinkPortCount = itemData.maxLinkPortCount;
+    _currentLinkPortState = itemData.linkPortState;
+    _pDataRoutes = itemData.dataRoutes;
+    _pItemImage = itemData.itemImage;
+    _pItemSelectedImage = itemData.itemSelectedImage;
+    _clearImageLod(false);
+    _clearImageLod(true);
+}
+
+void ElaGraphicsItemPrivate::_clearImageLod(bool isSelected)
+{
+    if (isSelected)
+    {
+        _itemSelectedPixmapMipVector.clear();
+        _itemSelectedImageColor = QColor();
+    }
+    else
+    {
+        _itemPixmapMipVector.clear();
+        _itemImageColor = QColor();
+    }
+}
+
+int ElaGraphicsItemPrivate::_getLodLevel(const QImage& image, QSizeF deviceSize) const
+{
+    // 取不小于目标设备尺寸的最小层级
+    int level = 0;
+    int mipWidth = image.width() / 2;
+    int mipHeight = image.height() / 2;
+    while (mipWidth >= 1 && mipHeight >= 1 && mipWidth >= deviceSize.width() && mipHeight >= deviceSize.height())
+    {
+        level++;
+        mipWidth /= 2;
+        mipHeight /= 2;
+    }
+    return level;
+}
+
+const QPixmap& ElaGraphicsItemPrivate::_getLodPixmap(bool isSelected, QSizeF deviceSize)
+{
+    const QImage& image = isSelected ? _pItemSelectedImage : _pItemImage;
+    QVector<QPixmap>& pixmapVector = isSelected ? _itemSelectedPixmapMipVector : _itemPixmapMipVector;
+    int level = _getLodLevel(image, deviceSize);
+    if (pixmapVector.count() <= level)
+    {
+        pixmapVector.resize(level + 1);
+    }
+    QPixmap& lodPixmap = pixmapVector[level];
+    if (lodPixmap.isNull())
+    {
+        // 缩放与格式转换只进行一次 同一图片的层级在图元间共享
+        QString pixmapKey = QString("ElaGraphicsItem_%1_%2").arg(image.cacheKey()).arg(level);
+        if (!QPixmapCache::find(pixmapKey, &lodPixmap))
+        {
+            QImage mipImage = level == 0 ? image : image.scaled(image.width() >> level, image.height() >> level, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+            lodPixmap = QPixmap::fromImage(mipImage);
+            QPixmapCache::insert(pixmapKey, lodPixmap);
+        }
+    }
+    return lodPixmap;
+}
+
+QColor ElaGraphicsItemPrivate::_getLodColor(bool isSelected)
+{
+    QColor& lodColor = isSelected ? _itemSelectedImageColor : _itemImageColor;
+    if (!lodColor.isValid())
+    {
+        // 由最小层级求平均色 避免对原图整体缩放
+        QImage lodImage = _getLodPixmap(isSelected, QSizeF(1, 1)).toImage();
+        lodColor = lodImage.isNull() ? QColor(0x80, 0x80, 0x80) : lodImage.scaled(1, 1, Qt::IgnoreAspectRatio, Qt::SmoothTransformation).pixelColor(0, 0);
+    }
+    return lodColor;
+}
+
 QDataStream& operator<<(QDataStream& stream, const ElaGraphicsItemPrivate* data)
 {
-    stream << data->_itemUID;
-    stream << data->_pItemName;
-    stream << data->_pMaxLinkPortCount;
-    stream << data->_currentLinkPortState;
-    stream << data->_pDataRoutes;
+    data->serializeAttribute(stream);
     stream << data->_pItemImage;
     stream << data->_pItemSelectedImage;
     return stream;
@@ -23,12 +138,10 @@ QDataStream& operator<<(QDataStream& stream, const ElaGraphicsItemPrivate* data)
 
 QDataStream& operator>>(QDataStream& stream, ElaGraphicsItemPrivate* data)
 {
-    stream >> data->_itemUID;
-    stream >> data->_pItemName;
-    stream >> data->_pMaxLinkPortCount;
-    stream >> data->_currentLinkPortState;
-    stream >> data->_pDataRoutes;
+    data->deserializeAttribute(stream);
     stream >> data->_pItemImage;
     stream >> data->_pItemSelectedImage;
+    data->_clearImageLod(false);
+    data->_clearImageLod(true);
     return stream;
 }
@@ -1,10 +1,14 @@
 #ifndef ELAGRAPHICSITEMPRIVATE_H
 #define ELAGRAPHICSITEMPRIVATE_H
 
+#include <QColor>
+#include <QImage>
 #include <QObject>
+#include <QPixmap>
 #include <QVector>
 
 #include "ElaGraphicsItem.h"
+struct ElaGraphicsItemData;
 class ElaGraphicsItemPrivate : public QObject
 {
     Q_OBJECT
@@ -22,9 +26,25 @@ public:
 
     friend QDataStream& operator<<(QDataStream& stream, const ElaGraphicsItemPrivate* data);
     friend QDataStream& operator>>(QDataStream& stream, ElaGraphicsItemPrivate* data);
+    // 不含图片的属性序列化 图片由场景图片表统一保存
+    void serializeAttribute(QDataStream& stream) const;
+    void deserializeAttribute(QDataStream& stream);
+    // 以解析好的数据初始化图元 应在加入场景前调用
+    void applyItemData(const ElaGraphicsItemData& itemData);
 
 private:
+    static constexpr qreal _lodFlatThreshold{8}; // 屏幕尺寸低于该像素值时以纯色块绘制
     QString _itemUID;
+    // LOD层级 第i层为原图的1/2^i 绘制时按需转换为QPixmap 重绘时直接贴图
+    QVector<QPixmap> _itemPixmapMipVector;
+    QVector<QPixmap> _itemSelectedPixmapMipVector;
+    QColor _itemImageColor;
+    QColor _itemSelectedImageColor;
+    void _clearImageLod(bool isSelected);
+    int _getLodLevel(const QImage& image, QSizeF deviceSize) const;
+    const QPixmap& _getLodPixmap(bool isSelected, QSizeF deviceSize);
+    QColor _getLodColor(bool isSelected);
+    void _notifySceneGeometryChanged();
     QVector<bool> _currentLinkPortState;
 };
 
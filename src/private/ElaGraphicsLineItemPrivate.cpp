@@ -1,5 +1,9 @@
 #include "ElaGraphicsLineItemPrivate.h"
 
+#include <QPainterPath>
+
+#include "ElaGraphicsItem.h"
+#include "ElaGraphicsLineItem.h"
 ElaGraphicsLineItemPrivate::ElaGraphicsLineItemPrivate()
 {
 }
@@ -7,3 +11,30 @@ ElaGraphicsLineItemPrivate::ElaGraphicsLineItemPrivate()
 ElaGraphicsLineItemPrivate::~ElaGraphicsLineItemPrivate()
 {
 }
+
+void ElaGraphicsLineItemPrivate::updateLinkPath()
+{
+    Q_Q(ElaGraphicsLineItem);
+    qreal pathXStart = 0;
+    qreal pathYStart = 0;
+    qreal pathXEnd = 0;
+    qreal pathYEnd = 0;
+    if (_isCreateWithItem)
+    {
+        pathXStart = _pStartItem->x();
+        pathYStart = _pStartItem->y();
+        pathXEnd = _pEndItem->x();
+        pathYEnd = _pEndItem->y();
+    }
+    else
+    {
+        pathXStart = _pStartPoint.x();
+        pathYStart = _pStartPoint.y();
+        pathXEnd = _pEndPoint.x();
+        pathYEnd = _pEndPoint.y();
+    }
+    QPainterPath path;
+    path.moveTo(pathXStart, pathYStart); // 设置起始点
+    path.cubicTo((pathXStart + pathXEnd) / 2, pathYStart, (pathXStart + pathXEnd) / 2, pathYEnd, pathXEnd, pathYEnd);
+    q->setPath(path);
+}
@@ -21,8 +21,11 @@ class ElaGraphicsLineItemPrivate
 public:
     explicit ElaGraphicsLineItemPrivate();
     ~ElaGraphicsLineItemPrivate();
+    // 端点变化时重新计算缓存路径 setPath只刷新新旧包围盒
+    void updateLinkPath();
 
 private:
+    static constexpr qreal _lodSimplifyThreshold{0.5}; // 缩放低于该值时简化绘制
     QMap<ElaGraphicsItem*, int> _linkItemMap;
     bool _isCreateWithItem{true};
 };
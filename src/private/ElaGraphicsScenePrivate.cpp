@@ -1,7 +1,15 @@
 #include "ElaGraphicsScenePrivate.h"
 
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QTimer>
+#include <algorithm>
+
+#include "ElaGraphicsImageTable.h"
 #include "ElaGraphicsItem.h"
+#include "ElaGraphicsItemPrivate.h"
 #include "ElaGraphicsLineItem.h"
+#include "ElaGraphicsLineItemPrivate.h"
 #include "ElaGraphicsScene.h"
 ElaGraphicsScenePrivate::ElaGraphicsScenePrivate(QObject* parent)
     : QObject(parent)
@@ -12,52 +20,313 @@ ElaGraphicsScenePrivate::~ElaGraphicsScenePrivate()
 {
 }
 
-QDataStream& operator<<(QDataStream& stream, const ElaGraphicsScenePrivate* data)
+void ElaGraphicsScenePrivate::onItemGeometryChanged(ElaGraphicsItem* item)
 {
-    QStringList keyList = data->_items.keys();
-    QList<ElaGraphicsItem*> itemList = data->_items.values();
-    stream << keyList;
-    for (int i = 0; i < keyList.count(); i++)
+    if (_itemIndexMode == ElaGraphicsSceneType::GridIndex)
+    {
+        _gridIndex.updateItem(item);
+    }
+    // 仅更新与该图元相连的连线
+    auto portIt = _itemLinkPortHash.constFind(item);
+    if (portIt == _itemLinkPortHash.constEnd())
     {
-        stream << itemList[i];
+        return;
     }
-    stream << data->_itemsLink;
+    for (auto port : portIt.value())
+    {
+        for (auto lineItem : _itemLinkHash.value(qMakePair(item, port)))
+        {
+            lineItem->d_func()->updateLinkPath();
+        }
+    }
+}
+
+QDataStream& operator<<(QDataStream& stream, const ElaGraphicsScenePrivate* data)
+{
+    data->_serializeScene(stream);
     return stream;
 }
 
 QDataStream& operator>>(QDataStream& stream, ElaGraphicsScenePrivate* data)
 {
+    data->_deserializeScene(stream);
+    return stream;
+}
+
+void ElaGraphicsScenePrivate::_serializeScene(QDataStream& stream) const
+{
+    // 版本2 文件头 + 图片表 + 图元(图片以ID引用) + 连接
+    stream << ElaGraphicsSceneLoader::serializeMagic;
+    stream << ElaGraphicsSceneLoader::serializeVersion;
+    stream << qint32(stream.version());
     QStringList keyList;
-    stream >> keyList;
-    QList<ElaGraphicsItem*> itemList = data->_serializeItem(keyList.count());
-    for (int i = 0; i < keyList.count(); i++)
+    QList<ElaGraphicsItem*> itemList;
+    keyList.reserve(_items.count());
+    itemList.reserve(_items.count());
+    for (const auto& itemPair : _itemOrderVector)
     {
-        stream >> itemList[i];
+        if (itemPair.second)
+        {
+            keyList.append(itemPair.first);
+            itemList.append(itemPair.second);
+        }
     }
-    for (int i = 0; i < keyList.count(); i++)
+    ElaGraphicsImageTable imageTable;
+    QVector<qint32> imageIDVector;
+    imageIDVector.reserve(itemList.count() * 2);
+    for (auto item : itemList)
     {
-        data->_items.insert(keyList[i], itemList[i]);
+        imageIDVector.append(imageTable.registerImage(item->getItemImage()));
+        imageIDVector.append(imageTable.registerImage(item->getItemSelectedImage()));
     }
-    stream >> data->_itemsLink;
-    data->_deserializeLink();
-    return stream;
+    stream << imageTable;
+    stream << keyList;
+    for (int i = 0; i < itemList.count(); i++)
+    {
+        ElaGraphicsItem* item = itemList[i];
+        stream << item->x() << item->y() << item->zValue() << item->getWidth() << item->getHeight();
+        item->d_func()->serializeAttribute(stream);
+        stream << imageIDVector[i * 2] << imageIDVector[i * 2 + 1];
+    }
+    stream << _getItemLinkList();
 }
 
-QList<ElaGraphicsItem*> ElaGraphicsScenePrivate::_serializeItem(int count)
+void ElaGraphicsScenePrivate::_deserializeScene(QDataStream& stream)
+{
+    ElaGraphicsSceneData sceneData;
+    if (!ElaGraphicsSceneLoader::readScene(stream, sceneData))
+    {
+        qWarning() << "ElaGraphicsScene deserialize: invalid scene data";
+        return;
+    }
+    _reserveItems(sceneData.keyList.count());
+    for (int i = 0; i < sceneData.keyList.count(); i++)
+    {
+        _createItem(sceneData.keyList[i], sceneData.itemDataVector[i]);
+    }
+    for (const auto& itemLinkData : sceneData.itemLinkList)
+    {
+        _deserializeLink(itemLinkData);
+    }
+}
+
+ElaGraphicsItem* ElaGraphicsScenePrivate::_createItem(const QString& key, const ElaGraphicsItemData& itemData)
 {
     Q_Q(ElaGraphicsScene);
+    // 加入场景前完成初始化 避免逐项触发几何变化通知
+    ElaGraphicsItem* item = new ElaGraphicsItem();
+    item->d_func()->applyItemData(itemData);
+    item->setParent(q);
+    q->QGraphicsScene::addItem(item);
+    _currentZ++;
+    _insertItem(key, item);
+    if (_itemIndexMode == ElaGraphicsSceneType::GridIndex)
+    {
+        _gridIndex.insertItem(item);
+    }
+    return item;
+}
+
+void ElaGraphicsScenePrivate::onLoadSceneFinished(quint64 requestID, QSharedPointer<ElaGraphicsSceneData> sceneData)
+{
+    if (!_isDeserializing || requestID != _loadRequestID)
+    {
+        return;
+    }
+    if (!sceneData)
+    {
+        _finishDeserialize(false);
+        return;
+    }
+    _loadSceneData = sceneData;
+    _loadItemIndex = 0;
+    _loadLinkIndex = 0;
+    _reserveItems(sceneData->keyList.count());
+    _loadTimer->start();
+}
+
+void ElaGraphicsScenePrivate::onLoadTimerTimeout()
+{
+    Q_Q(ElaGraphicsScene);
+    if (!_loadSceneData)
+    {
+        _loadTimer->stop();
+        return;
+    }
+    QElapsedTimer batchTimer;
+    batchTimer.start();
+    const int itemCount = _loadSceneData->keyList.count();
+    const int linkCount = _loadSceneData->itemLinkList.count();
+    // 先创建图元 全部就位后再创建连接 每批不超过时间预算 保证界面可交互
+    // 处理后再检查耗时 预算非正时每批至少推进一项
+    do
+    {
+        if (_loadItemIndex < itemCount)
+        {
+            _createItem(_loadSceneData->keyList[_loadItemIndex], _loadSceneData->itemDataVector[_loadItemIndex]);
+            _loadItemIndex++;
+        }
+        else if (_loadLinkIndex < linkCount)
+        {
+            _deserializeLink(_loadSceneData->itemLinkList[_loadLinkIndex]);
+            _loadLinkIndex++;
+        }
+        else
+        {
+            break;
+        }
+    } while (batchTimer.elapsed() < _pDeserializeBatchMsec);
+    Q_EMIT q->deserializeProgress(_loadItemIndex + _loadLinkIndex, itemCount + linkCount);
+    if (_loadItemIndex == itemCount && _loadLinkIndex == linkCount)
+    {
+        _finishDeserialize(true);
+    }
+}
+
+void ElaGraphicsScenePrivate::_reserveItems(int count)
+{
+    _items.reserve(_items.count() + count);
+    _itemOrderHash.reserve(_itemOrderHash.count() + count);
+    _itemOrderVector.reserve(_itemOrderVector.count() + count);
+}
+
+void ElaGraphicsScenePrivate::_insertItem(const QString& key, ElaGraphicsItem* item)
+{
+    // 同UID的旧item被替换 与哈希表的覆盖语义一致
+    ElaGraphicsItem* oldItem = _items.value(key);
+    if (oldItem && oldItem != item)
+    {
+        _removeItem(oldItem);
+    }
+    if (_itemOrderHash.contains(item))
+    {
+        return;
+    }
+    _items.insert(key, item);
+    _itemOrderHash.insert(item, _itemOrderVector.count());
+    _itemOrderVector.append(qMakePair(key, item));
+}
+
+void ElaGraphicsScenePrivate::_removeItem(ElaGraphicsItem* item)
+{
+    auto orderIt = _itemOrderHash.find(item);
+    if (orderIt == _itemOrderHash.end())
+    {
+        return;
+    }
+    QPair<QString, ElaGraphicsItem*>& itemPair = _itemOrderVector[orderIt.value()];
+    if (_items.value(itemPair.first) == item)
+    {
+        _items.remove(itemPair.first);
+    }
+    itemPair.second = nullptr;
+    _itemOrderHash.erase(orderIt);
+    _removedItemCount++;
+    // 空位过半时压缩 均摊O(1)
+    if (_removedItemCount * 2 > _itemOrderVector.count())
+    {
+        QVector<QPair<QString, ElaGraphicsItem*>> itemOrderVector;
+        itemOrderVector.reserve(_itemOrderHash.count());
+        for (const auto& orderPair : _itemOrderVector)
+        {
+            if (orderPair.second)
+            {
+                _itemOrderHash[orderPair.second] = itemOrderVector.count();
+                itemOrderVector.append(orderPair);
+            }
+        }
+        _itemOrderVector.swap(itemOrderVector);
+        _removedItemCount = 0;
+    }
+}
+
+void ElaGraphicsScenePrivate::_clearItems()
+{
+    _items.clear();
+    _itemOrderVector.clear();
+    _itemOrderHash.clear();
+    _removedItemCount = 0;
+}
+
+QList<ElaGraphicsItem*> ElaGraphicsScenePrivate::_getItemList() const
+{
     QList<ElaGraphicsItem*> itemList;
-    for (int i = 0; i < count; i++)
+    itemList.reserve(_itemOrderHash.count());
+    for (const auto& itemPair : _itemOrderVector)
     {
-        ElaGraphicsItem* item = new ElaGraphicsItem();
-        item->setParent(q);
-        itemList.append(item);
-        q->QGraphicsScene::addItem(item);
-        _currentZ++;
+        if (itemPair.second)
+        {
+            itemList.append(itemPair.second);
+        }
     }
     return itemList;
 }
 
+void ElaGraphicsScenePrivate::_cancelDeserialize()
+{
+    Q_Q(ElaGraphicsScene);
+    if (!_isDeserializing)
+    {
+        return;
+    }
+    _loader->cancelLoad();
+    _loadTimer->stop();
+    // 撤销已创建的部分 场景恢复到加载前的状态
+    if (_loadSceneData)
+    {
+        QList<ElaGraphicsItem*> loadItemList;
+        loadItemList.reserve(_loadItemIndex);
+        for (int i = 0; i < _loadItemIndex; i++)
+        {
+            ElaGraphicsItem* item = _items.value(_loadSceneData->keyList[i]);
+            if (item)
+            {
+                loadItemList.append(item);
+            }
+        }
+        q->removeItems(loadItemList);
+    }
+    _finishDeserialize(false);
+}
+
+void ElaGraphicsScenePrivate::_finishDeserialize(bool isSuccess)
+{
+    Q_Q(ElaGraphicsScene);
+    _loadTimer->stop();
+    _loadSceneData.reset();
+    _loadItemIndex = 0;
+    _loadLinkIndex = 0;
+    _isDeserializing = false;
+    q->update();
+    Q_EMIT q->deserializeFinished(isSuccess);
+}
+
+QList<ElaGraphicsItem*> ElaGraphicsScenePrivate::_filterElaItems(const QList<QGraphicsItem*>& itemList) const
+{
+    QList<ElaGraphicsItem*> elaItemList;
+    for (auto item : itemList)
+    {
+        ElaGraphicsItem* elaItem = dynamic_cast<ElaGraphicsItem*>(item);
+        if (elaItem)
+        {
+            elaItemList.append(elaItem);
+        }
+    }
+    return elaItemList;
+}
+
+void ElaGraphicsScenePrivate::_rebuildItemIndex()
+{
+    if (_itemIndexMode == ElaGraphicsSceneType::GridIndex)
+    {
+        _gridIndex.rebuild(_getItemList());
+    }
+    else
+    {
+        _gridIndex.clear();
+    }
+}
+
 void ElaGraphicsScenePrivate::_removeLinkLineItem()
 {
     Q_Q(ElaGraphicsScene);
@@ -69,16 +338,121 @@ void ElaGraphicsScenePrivate::_removeLinkLineItem()
     }
 }
 
-void ElaGraphicsScenePrivate::_deserializeLink()
+void ElaGraphicsScenePrivate::_attachLink(ElaGraphicsLineItem* lineItem)
 {
     Q_Q(ElaGraphicsScene);
-    for (int i = 0; i < _itemsLink.count(); i++)
+    q->QGraphicsScene::addItem(lineItem);
+    quint64 lineItemOrder = _lineItemOrder++;
+    _lineItemMap.insert(lineItemOrder, lineItem);
+    _lineItemOrderHash.insert(lineItem, lineItemOrder);
+    for (auto item : {lineItem->getStartItem(), lineItem->getEndItem()})
+    {
+        int port = _getLinkItemPort(lineItem, item);
+        QVector<ElaGraphicsLineItem*>& lineItemVector = _itemLinkHash[qMakePair(item, port)];
+        if (lineItemVector.isEmpty())
+        {
+            _itemLinkPortHash[item].append(port);
+        }
+        lineItemVector.append(lineItem);
+    }
+}
+
+void ElaGraphicsScenePrivate::_detachLink(ElaGraphicsLineItem* lineItem)
+{
+    Q_Q(ElaGraphicsScene);
+    for (auto item : {lineItem->getStartItem(), lineItem->getEndItem()})
+    {
+        int port = _getLinkItemPort(lineItem, item);
+        auto it = _itemLinkHash.find(qMakePair(item, port));
+        if (it == _itemLinkHash.end())
+        {
+            continue;
+        }
+        it.value().removeOne(lineItem);
+        if (it.value().isEmpty())
+        {
+            _itemLinkHash.erase(it);
+            auto portIt = _itemLinkPortHash.find(item);
+            portIt.value().removeOne(port);
+            if (portIt.value().isEmpty())
+            {
+                _itemLinkPortHash.erase(portIt);
+            }
+        }
+    }
+    _lineItemMap.remove(_lineItemOrderHash.take(lineItem));
+    q->QGraphicsScene::removeItem(lineItem);
+    delete lineItem;
+}
+
+ElaGraphicsItem* ElaGraphicsScenePrivate::_getOtherLinkItem(ElaGraphicsLineItem* lineItem, ElaGraphicsItem* item) const
+{
+    return lineItem->getStartItem() == item ? lineItem->getEndItem() : lineItem->getStartItem();
+}
+
+int ElaGraphicsScenePrivate::_getLinkItemPort(ElaGraphicsLineItem* lineItem, ElaGraphicsItem* item) const
+{
+    return lineItem->getStartItem() == item ? lineItem->getStartItemPort() : lineItem->getEndItemPort();
+}
+
+QVector<ElaGraphicsLineItem*> ElaGraphicsScenePrivate::_getItemLinks(ElaGraphicsItem* item) const
+{
+    QVector<ElaGraphicsLineItem*> lineItemVector;
+    auto portIt = _itemLinkPortHash.constFind(item);
+    if (portIt == _itemLinkPortHash.constEnd())
+    {
+        return lineItemVector;
+    }
+    for (auto port : portIt.value())
+    {
+        lineItemVector.append(_itemLinkHash.value(qMakePair(item, port)));
+    }
+    if (portIt.value().count() > 1)
+    {
+        std::sort(lineItemVector.begin(), lineItemVector.end(), [=](ElaGraphicsLineItem* lineItem1, ElaGraphicsLineItem* lineItem2) {
+            return _lineItemOrderHash.value(lineItem1) < _lineItemOrderHash.value(lineItem2);
+        });
+    }
+    return lineItemVector;
+}
+
+int ElaGraphicsScenePrivate::_getItemLinkCount(ElaGraphicsItem* item) const
+{
+    int linkCount = 0;
+    for (auto port : _itemLinkPortHash.value(item))
+    {
+        linkCount += _itemLinkHash.value(qMakePair(item, port)).count();
+    }
+    return linkCount;
+}
+
+QList<QVariantMap> ElaGraphicsScenePrivate::_getItemLinkList() const
+{
+    QList<QVariantMap> itemLinkList;
+    itemLinkList.reserve(_lineItemMap.count());
+    for (auto lineItem : _lineItemMap)
+    {
+        QVariantMap linkObject;
+        linkObject.insert(lineItem->getStartItem()->getItemUID(), lineItem->getStartItemPort());
+        linkObject.insert(lineItem->getEndItem()->getItemUID(), lineItem->getEndItemPort());
+        itemLinkList.append(linkObject);
+    }
+    return itemLinkList;
+}
+
+void ElaGraphicsScenePrivate::_deserializeLink(const QVariantMap& itemLinkData)
+{
+    QList<QString> uidList = itemLinkData.keys();
+    QList<QVariant> portList = itemLinkData.values();
+    if (uidList.count() != 2)
+    {
+        return;
+    }
+    ElaGraphicsItem* item1 = _items.value(uidList[0]);
+    ElaGraphicsItem* item2 = _items.value(uidList[1]);
+    if (!item1 || !item2)
     {
-        QVariantMap itemLinkData = _itemsLink[i];
-        QList<QString> uidList = itemLinkData.keys();
-        QList<QVariant> portList = itemLinkData.values();
-        ElaGraphicsLineItem* lineItem = new ElaGraphicsLineItem(_items.value(uidList[0]), _items.value(uidList[1]), portList[0].toInt(), portList[1].toInt());
-        q->QGraphicsScene::addItem(lineItem);
-        _lineItemsList.append(lineItem);
+        return;
     }
+    _attachLink(new ElaGraphicsLineItem(item1, item2, portList[0].toInt(), portList[1].toInt()));
 }
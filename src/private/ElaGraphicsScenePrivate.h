@@ -1,20 +1,30 @@
 #ifndef ELAGRAPHICSSCENEPRIVATE_H
 #define ELAGRAPHICSSCENEPRIVATE_H
 
+#include <QHash>
 #include <QMap>
 #include <QObject>
+#include <QPair>
 #include <QPointF>
+#include <QSet>
+#include <QSharedPointer>
+#include <QVector>
 
+#include "ElaGraphicsGridIndex.h"
 #include "ElaGraphicsScene.h"
+#include "ElaGraphicsSceneLoader.h"
 #include "stdafx.h"
 class ElaGraphicsItem;
 class ElaGraphicsLineItem;
+class QThread;
+class QTimer;
 class ElaGraphicsScenePrivate : public QObject
 {
     Q_OBJECT
     Q_D_CREATE(ElaGraphicsScene)
     Q_PROPERTY_CREATE_D(bool, IsCheckLinkPort)
     Q_PROPERTY_CREATE_D(QString, SerializePath)
+    Q_PROPERTY_CREATE_D(int, DeserializeBatchMsec)
 public:
     explicit ElaGraphicsScenePrivate(QObject* parent = nullptr);
     ~ElaGraphicsScenePrivate();
@@ -22,19 +32,62 @@ public:
     friend QDataStream& operator<<(QDataStream& stream, const ElaGraphicsScenePrivate* data);
     friend QDataStream& operator>>(QDataStream& stream, ElaGraphicsScenePrivate* data);
 
+    void onItemGeometryChanged(ElaGraphicsItem* item);
+    Q_SLOT void onLoadSceneFinished(quint64 requestID, QSharedPointer<ElaGraphicsSceneData> sceneData);
+    Q_SLOT void onLoadTimerTimeout();
+Q_SIGNALS:
+    Q_SIGNAL void loadScene(quint64 requestID, QString filePath);
+
 private:
     bool _isLeftButtonPress{false};
-    QMap<QString, ElaGraphicsItem*> _items; // 存储所有item
+    QHash<QString, ElaGraphicsItem*> _items;                 // 存储所有item 查找与去重O(1)
+    QVector<QPair<QString, ElaGraphicsItem*>> _itemOrderVector; // 按加入顺序 删除处留空 保证遍历与序列化顺序稳定
+    QHash<ElaGraphicsItem*, int> _itemOrderHash;                // item->_itemOrderVector下标
+    int _removedItemCount{0};
+    ElaGraphicsSceneType::ItemIndexMode _itemIndexMode{ElaGraphicsSceneType::NoIndex};
+    ElaGraphicsGridIndex _gridIndex;
+    bool _isBatchUpdating{false};
     ElaGraphicsSceneType::SceneMode _sceneMode;
-    QList<QVariantMap> _itemsLink; // item连接状态
-    QList<ElaGraphicsLineItem*> _lineItemsList;
+    QHash<QPair<ElaGraphicsItem*, int>, QVector<ElaGraphicsLineItem*>> _itemLinkHash; // 邻接表 (item, port)->关联连线 按连接顺序
+    QHash<ElaGraphicsItem*, QVector<int>> _itemLinkPortHash;                             // item->已连接的端口
+    QMap<quint64, ElaGraphicsLineItem*> _lineItemMap;                                    // 全部连线 按连接顺序
+    QHash<ElaGraphicsLineItem*, quint64> _lineItemOrderHash;
+    quint64 _lineItemOrder{0};
     ElaGraphicsLineItem* _linkLineItem{nullptr};
     qreal _currentZ{1};
     QPointF _lastPos;
     QPointF _lastLeftPressPos;
-    QList<ElaGraphicsItem*> _serializeItem(int count);
+    // 异步加载 工作线程解析 GUI线程按时间片创建图元与连接
+    QThread* _loaderThread{nullptr};
+    ElaGraphicsSceneLoader* _loader{nullptr};
+    QTimer* _loadTimer{nullptr};
+    quint64 _loadRequestID{0};
+    bool _isDeserializing{false};
+    QSharedPointer<ElaGraphicsSceneData> _loadSceneData;
+    int _loadItemIndex{0};
+    int _loadLinkIndex{0};
+    ElaGraphicsItem* _createItem(const QString& key, const ElaGraphicsItemData& itemData);
+    void _reserveItems(int count);
+    void _insertItem(const QString& key, ElaGraphicsItem* item);
+    void _removeItem(ElaGraphicsItem* item);
+    void _clearItems();
+    QList<ElaGraphicsItem*> _getItemList() const;
+    void _cancelDeserialize();
+    void _finishDeserialize(bool isSuccess);
+    QList<ElaGraphicsItem*> _filterElaItems(const QList<QGraphicsItem*>& itemList) const;
+    void _rebuildItemIndex();
     void _removeLinkLineItem();
-    void _deserializeLink();
+    void _attachLink(ElaGraphicsLineItem* lineItem);
+    void _detachLink(ElaGraphicsLineItem* lineItem);
+    ElaGraphicsItem* _getOtherLinkItem(ElaGraphicsLineItem* lineItem, ElaGraphicsItem* item) const;
+    int _getLinkItemPort(ElaGraphicsLineItem* lineItem, ElaGraphicsItem* item) const;
+    // 图元全部端口的连线 按连接顺序
+    QVector<ElaGraphicsLineItem*> _getItemLinks(ElaGraphicsItem* item) const;
+    int _getItemLinkCount(ElaGraphicsItem* item) const;
+    QList<QVariantMap> _getItemLinkList() const;
+    void _deserializeLink(const QVariantMap& itemLinkData);
+    void _serializeScene(QDataStream& stream) const;
+    void _deserializeScene(QDataStream& stream);
 };
 
 #endif // ELAGRAPHICSSCENEPRIVATE_H
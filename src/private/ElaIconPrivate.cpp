@@ -0,0 +1,50 @@
+#include "ElaIconPrivate.h"
+
+#include <QGuiApplication>
+#include <QPainter>
+
+ElaIconPrivate::ElaIconPrivate()
+{
+}
+
+ElaIconPrivate::~ElaIconPrivate()
+{
+}
+
+ElaIconCacheData ElaIconPrivate::_getIconCacheData(ElaIconType::IconName awesome, int pixelSize, int fixedWidth, int fixedHeight, QColor iconColor, qreal devicePixelRatio)
+{
+    if (devicePixelRatio <= 0)
+    {
+        devicePixelRatio = qApp->devicePixelRatio();
+    }
+    QPair<quint64, quint64> cacheKey;
+    cacheKey.first = (quint64(quint16(awesome)) << 48) | (quint64(quint16(pixelSize)) << 32) | (quint64(quint16(fixedWidth)) << 16) | quint64(quint16(fixedHeight));
+    cacheKey.second = (quint64(iconColor.rgba()) << 32) | quint64(qRound(devicePixelRatio * 100));
+    if (ElaIconCacheData* cacheData = _iconCache.object(cacheKey))
+    {
+        _cacheHitCount++;
+        return *cacheData;
+    }
+    _cacheMissCount++;
+    // 按设备像素绘制一次 之后以隐式共享的QPixmap/QIcon返回
+    QFont iconFont = QFont("ElaAwesome");
+    QPixmap pix(QSize(fixedWidth, fixedHeight) * devicePixelRatio);
+    pix.setDevicePixelRatio(devicePixelRatio);
+    pix.fill(Qt::transparent);
+    QPainter painter;
+    painter.begin(&pix);
+    painter.setRenderHints(QPainter::Antialiasing | QPainter::TextAntialiasing | QPainter::SmoothPixmapTransform);
+    painter.setPen(iconColor);
+    iconFont.setPixelSize(pixelSize);
+    painter.setFont(iconFont);
+    // 画图形字体
+    painter.drawText(QRect(0, 0, fixedWidth, fixedHeight), Qt::AlignCenter, QChar((unsigned short)awesome));
+    painter.end();
+    ElaIconCacheData cacheData;
+    cacheData.iconPixmap = pix;
+    cacheData.icon = QIcon(pix);
+    int cacheCost = qMax(1, pix.width() * pix.height() * 4 / 1024);
+    // 代价超过上限时insert会直接删除该对象 故插入副本
+    _iconCache.insert(cacheKey, new ElaIconCacheData(cacheData), cacheCost);
+    return cacheData;
+}
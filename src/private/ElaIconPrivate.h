@@ -0,0 +1,35 @@
+#ifndef ELAICONPRIVATE_H
+#define ELAICONPRIVATE_H
+
+#include <QCache>
+#include <QColor>
+#include <QIcon>
+#include <QPair>
+#include <QPixmap>
+
+#include "Def.h"
+#include "stdafx.h"
+class ElaIcon;
+struct ElaIconCacheData
+{
+    QPixmap iconPixmap;
+    QIcon icon;
+};
+
+class ElaIconPrivate
+{
+    Q_D_CREATE(ElaIcon)
+public:
+    explicit ElaIconPrivate();
+    ~ElaIconPrivate();
+
+private:
+    // 键 (图标, 字号, 宽, 高) + (颜色, 设备像素比*100)
+    QCache<QPair<quint64, quint64>, ElaIconCacheData> _iconCache;
+    int _cacheHitCount{0};
+    int _cacheMissCount{0};
+    // 按值返回 QCache::insert可能立即淘汰并删除新插入的对象
+    ElaIconCacheData _getIconCacheData(ElaIconType::IconName awesome, int pixelSize, int fixedWidth, int fixedHeight, QColor iconColor, qreal devicePixelRatio);
+};
+
+#endif // ELAICONPRIVATE_H
@@ -0,0 +1,19 @@
+#include "ElaImageCachePrivate.h"
+
+ElaImageCachePrivate::ElaImageCachePrivate(QObject* parent)
+    : QObject{parent}
+{
+}
+
+ElaImageCachePrivate::~ElaImageCachePrivate()
+{
+}
+
+QString ElaImageCachePrivate::_getCacheKey(const QString& imagePath, QSize imageSize) const
+{
+    if (!imageSize.isValid())
+    {
+        return imagePath;
+    }
+    return QString("%1@%2x%3").arg(imagePath).arg(imageSize.width()).arg(imageSize.height());
+}
@@ -0,0 +1,29 @@
+#ifndef ELAIMAGECACHEPRIVATE_H
+#define ELAIMAGECACHEPRIVATE_H
+
+#include <QCache>
+#include <QImage>
+#include <QMutex>
+#include <QObject>
+#include <QSet>
+
+#include "stdafx.h"
+class ElaImageCache;
+class ElaImageCachePrivate : public QObject
+{
+    Q_OBJECT
+    Q_D_CREATE(ElaImageCache)
+public:
+    explicit ElaImageCachePrivate(QObject* parent = nullptr);
+    ~ElaImageCachePrivate();
+
+private:
+    mutable QMutex _cacheMutex;
+    QCache<QString, QImage> _imageCache;
+    QSet<QString> _pixmapKeySet;
+    int _cacheHitCount{0};
+    int _cacheMissCount{0};
+    QString _getCacheKey(const QString& imagePath, QSize imageSize) const;
+};
+
+#endif // ELAIMAGECACHEPRIVATE_H
@@ -1,65 +1,117 @@
 #include "ElaMessageBarPrivate.h"
 
-#include <QDateTime>
-#include <QGraphicsOpacityEffect>
+#include <QApplication>
+#include <QEvent>
 #include <QPainter>
 #include <QPainterPath>
-#include <QPropertyAnimation>
+#include <QSet>
 #include <QTimer>
 
+#include "ElaAnimationScheduler.h"
 #include "ElaIconButton.h"
 #include "ElaMessageBar.h"
 Q_SINGLETON_CREATE_CPP(ElaMessageBarManager)
-QMap<ElaMessageBarType::PositionPolicy, QList<ElaMessageBar*>*> _messageBarActiveMap;
+static const char* _getLayoutAnimationKey(int policy)
+{
+    // 调度器以target与静态字符串区分动画 每个策略一条布局动画
+    static const char* layoutAnimationKeyArray[] = {"TopLayout", "LeftLayout", "BottomLayout", "RightLayout", "TopRightLayout", "TopLeftLayout", "BottomRightLayout", "BottomLeftLayout"};
+    return layoutAnimationKeyArray[policy];
+}
+
 ElaMessageBarManager::ElaMessageBarManager(QObject* parent)
 {
+    // 首次调用可能来自工作线程 管理器始终归属GUI线程
+    moveToThread(QApplication::instance()->thread());
 }
 
 ElaMessageBarManager::~ElaMessageBarManager()
 {
 }
 
-void ElaMessageBarManager::requestMessageBarEvent(ElaMessageBar* messageBar)
+void ElaMessageBarManager::postMessageBar(QWidget* parent, ElaMessageBarType::PositionPolicy policy, ElaMessageBarType::MessageMode messageMode, const QString& title, const QString& text, int displayMsec, int repeatCount)
 {
-    if (!messageBar)
+    if (!parent)
     {
         return;
     }
-    if (_messageBarEventMap.contains(messageBar))
+    LaneKey laneKey(parent, policy);
+    if (!_laneMap.contains(laneKey))
     {
-        QList<QVariantMap> eventList = _messageBarEventMap.value(messageBar);
-        QVariantMap eventData = eventList.last();
-        eventList.removeLast();
-        if (eventList.isEmpty())
+        parent->installEventFilter(this);
+        connect(parent, &QObject::destroyed, this, &ElaMessageBarManager::onParentDestroyed, Qt::UniqueConnection);
+    }
+    ElaMessageBarLane& lane = _laneMap[laneKey];
+    // 相同消息合并计数
+    for (auto messageBar : lane.activeBarList)
+    {
+        if (messageBar->d_ptr->_getIsSameMessage(messageMode, title, text))
         {
-            _messageBarEventMap.remove(messageBar);
+            messageBar->d_ptr->_addRepeatCount(repeatCount, displayMsec);
+            return;
         }
-        else
+    }
+    for (auto& pendingData : lane.pendingQueue)
+    {
+        if (pendingData.messageMode == messageMode && pendingData.title == title && pendingData.text == text)
         {
-            _messageBarEventMap[messageBar] = eventList;
+            pendingData.repeatCount += repeatCount;
+            pendingData.displayMsec = displayMsec;
+            return;
         }
-        //触发事件
-        QString functionName = eventData.value("EventFunctionName").toString();
-        QVariantMap functionData = eventData.value("EventFunctionData").toMap();
-        QMetaObject::invokeMethod(messageBar->d_func(), functionName.toLocal8Bit().constData(), Qt::AutoConnection, Q_ARG(QVariantMap, functionData));
     }
+    ElaMessageBarPendingData pendingData;
+    pendingData.messageMode = messageMode;
+    pendingData.title = title;
+    pendingData.text = text;
+    pendingData.displayMsec = displayMsec;
+    pendingData.repeatCount = repeatCount;
+    if (lane.pendingQueue.count() >= _maximumPendingCount)
+    {
+        // 排队过多时丢弃最早的消息
+        lane.pendingQueue.dequeue();
+    }
+    lane.pendingQueue.enqueue(pendingData);
+    _dispatchPendingMessageBar(laneKey);
 }
 
-void ElaMessageBarManager::postMessageBarCreateEvent(ElaMessageBar* messageBar)
+void ElaMessageBarManager::postMessageBarAsync(QWidget* parent, ElaMessageBarType::PositionPolicy policy, ElaMessageBarType::MessageMode messageMode, const QString& title, const QString& text, int displayMsec)
 {
-    if (!messageBar)
+    QMutexLocker locker(&_postMutex);
+    bool isMerged = false;
+    for (auto& postData : _postDataVector)
     {
-        return;
+        if (postData.parentKey == parent && postData.policy == policy && postData.messageMode == messageMode)
+        {
+            // 保留最近一条的内容
+            postData.title = title;
+            postData.text = text;
+            postData.displayMsec = displayMsec;
+            postData.postCount++;
+            isMerged = true;
+            break;
+        }
+    }
+    if (!isMerged)
+    {
+        ElaMessageBarPostData postData;
+        postData.parentKey = parent;
+        postData.policy = policy;
+        postData.messageMode = messageMode;
+        postData.title = title;
+        postData.text = text;
+        postData.displayMsec = displayMsec;
+        postData.postCount = 1;
+        _postDataVector.append(postData);
     }
-    updateActiveMap(messageBar, true); // 计算坐标前增加
-    if (!_messageBarEventMap.contains(messageBar))
+    if (_isPostFlushScheduled)
     {
-        QList<QVariantMap> eventList;
-        QVariantMap eventData;
-        eventData.insert("EventFunctionName", "messageBarEnd");
-        eventList.append(eventData);
-        _messageBarEventMap.insert(messageBar, eventList);
+        return;
     }
+    _isPostFlushScheduled = true;
+    int aggregationWindow = _aggregationWindow;
+    QMetaObject::invokeMethod(this, [=]() {
+        QTimer::singleShot(aggregationWindow, this, &ElaMessageBarManager::_flushPostedMessageBar);
+    }, Qt::QueuedConnection);
 }
 
 void ElaMessageBarManager::postMessageBarEndEvent(ElaMessageBar* messageBar)
@@ -68,360 +120,377 @@ void ElaMessageBarManager::postMessageBarEndEvent(ElaMessageBar* messageBar)
     {
         return;
     }
-    updateActiveMap(messageBar, false);
-    //Other MessageBar事件入栈 记录同一策略事件
-    ElaMessageBarType::PositionPolicy policy = messageBar->d_ptr->_policy;
-    foreach (auto otherMessageBar, *_messageBarActiveMap.value(policy))
+    LaneKey laneKey = _getLaneKey(messageBar);
+    auto laneIt = _laneMap.find(laneKey);
+    if (laneIt == _laneMap.end() || !laneIt->activeBarList.removeOne(messageBar))
+    {
+        return;
+    }
+    for (int i = laneIt->layoutDataVector.count() - 1; i >= 0; i--)
     {
-        if (otherMessageBar->d_ptr->_judgeCreateOrder(messageBar))
+        if (laneIt->layoutDataVector[i].messageBar == messageBar)
         {
-            QList<QVariantMap> eventList = _messageBarEventMap[otherMessageBar];
-            //优先执行先触发的事件 End事件保持首位
-            QVariantMap eventData;
-            eventData.insert("EventFunctionName", "onOtherMessageBarEnd");
-            QVariantMap functionData;
-            functionData.insert("TargetPosY", otherMessageBar->d_ptr->_calculateTargetPosY());
-            eventData.insert("EventFunctionData", functionData);
-            //若处于创建动画阶段  则合并事件动画
-            if (otherMessageBar->d_ptr->getWorkMode() == WorkStatus::CreateAnimation)
-            {
-                while (eventList.count() > 1)
-                {
-                    eventList.removeLast();
-                }
-            }
-            eventList.insert(1, eventData);
-            _messageBarEventMap[otherMessageBar] = eventList;
-            otherMessageBar->d_ptr->tryToRequestMessageBarEvent();
+            laneIt->layoutDataVector.remove(i);
         }
     }
+    _updateLaneLayout(laneKey, true);
+    _dispatchPendingMessageBar(laneKey);
+    laneIt = _laneMap.find(laneKey);
+    if (laneIt != _laneMap.end() && laneIt->activeBarList.isEmpty() && laneIt->pendingQueue.isEmpty())
+    {
+        _removeLane(laneKey);
+    }
 }
 
-void ElaMessageBarManager::forcePostMessageBarEndEvent(ElaMessageBar* messageBar)
+void ElaMessageBarManager::removeMessageBar(ElaMessageBar* messageBar)
 {
     if (!messageBar)
     {
         return;
     }
-    //清除事件堆栈记录
-    _messageBarEventMap.remove(messageBar);
-    //发布终止事件
-    postMessageBarEndEvent(messageBar);
-}
-
-int ElaMessageBarManager::getMessageBarEventCount(ElaMessageBar* messageBar)
-{
-    if (!messageBar)
+    // 析构路径不同步布局或派发 父窗口可能正在销毁
+    LaneKey laneKey = _getLaneKey(messageBar);
+    auto laneIt = _laneMap.find(laneKey);
+    if (laneIt == _laneMap.end() || !laneIt->activeBarList.removeOne(messageBar))
+    {
+        return;
+    }
+    for (int i = laneIt->layoutDataVector.count() - 1; i >= 0; i--)
+    {
+        if (laneIt->layoutDataVector[i].messageBar == messageBar)
+        {
+            laneIt->layoutDataVector.remove(i);
+        }
+    }
+    if (!laneIt->pendingQueue.isEmpty())
     {
-        return -1;
+        // 排队消息延后派发 父窗口若随后销毁 队列已由onParentDestroyed移除
+        QMetaObject::invokeMethod(this, [=]() {
+            _dispatchPendingMessageBar(laneKey);
+        }, Qt::QueuedConnection);
     }
-    if (!_messageBarEventMap.contains(messageBar))
+    else if (laneIt->activeBarList.isEmpty())
     {
-        return -1;
+        _removeLane(laneKey);
     }
-    QList<QVariantMap> eventList = _messageBarEventMap[messageBar];
-    return eventList.count();
 }
 
-void ElaMessageBarManager::updateActiveMap(ElaMessageBar* messageBar, bool isActive)
+void ElaMessageBarManager::setMaximumVisibleCount(int count)
 {
-    if (!messageBar)
+    _maximumVisibleCount = qMax(1, count);
+    // 超出上限的消息条自然结束 不强制关闭
+    QList<LaneKey> laneKeyList = _laneMap.keys();
+    for (const auto& laneKey : laneKeyList)
     {
-        return;
+        _dispatchPendingMessageBar(laneKey);
     }
-    ElaMessageBarType::PositionPolicy policy = messageBar->d_ptr->_policy;
-    if (isActive)
+}
+
+int ElaMessageBarManager::getMaximumVisibleCount() const
+{
+    return _maximumVisibleCount;
+}
+
+void ElaMessageBarManager::setAggregationWindow(int msec)
+{
+    QMutexLocker locker(&_postMutex);
+    _aggregationWindow = qMax(0, msec);
+}
+
+int ElaMessageBarManager::getAggregationWindow() const
+{
+    QMutexLocker locker(&_postMutex);
+    return _aggregationWindow;
+}
+
+void ElaMessageBarManager::onParentDestroyed(QObject* parent)
+{
+    QList<LaneKey> laneKeyList = _laneMap.keys();
+    for (const auto& laneKey : laneKeyList)
     {
-        if (_messageBarActiveMap.contains(policy))
-        {
-            _messageBarActiveMap[policy]->append(messageBar);
-        }
-        else
+        if (laneKey.first == parent)
         {
-            QList<ElaMessageBar*>* messageBarList = new QList<ElaMessageBar*>();
-            messageBarList->append(messageBar);
-            _messageBarActiveMap.insert(policy, messageBarList);
+            _laneMap.remove(laneKey);
         }
     }
-    else
+}
+
+bool ElaMessageBarManager::eventFilter(QObject* watched, QEvent* event)
+{
+    if (event->type() == QEvent::Resize)
     {
-        if (_messageBarActiveMap.contains(policy))
+        QList<LaneKey> laneKeyList = _laneMap.keys();
+        for (const auto& laneKey : laneKeyList)
         {
-            if (_messageBarActiveMap[policy]->count() > 0)
+            if (laneKey.first == watched)
             {
-                _messageBarActiveMap[policy]->removeOne(messageBar);
+                _updateLaneLayout(laneKey, false);
+                // 父窗口变高后可容纳更多消息
+                _dispatchPendingMessageBar(laneKey);
             }
         }
     }
+    return QObject::eventFilter(watched, event);
 }
 
-ElaMessageBarPrivate::ElaMessageBarPrivate(QObject* parent)
-    : QObject{parent}
+ElaMessageBarManager::LaneKey ElaMessageBarManager::_getLaneKey(ElaMessageBar* messageBar) const
 {
-    setProperty("MessageBarClosedY", 0);
-    setProperty("MessageBarFinishY", 0);
-    _createTime = QDateTime::currentMSecsSinceEpoch();
+    return LaneKey(messageBar->d_ptr->_parentWidget, messageBar->d_ptr->_policy);
 }
 
-ElaMessageBarPrivate::~ElaMessageBarPrivate()
+void ElaMessageBarManager::_showMessageBar(const LaneKey& laneKey, const ElaMessageBarPendingData& pendingData)
 {
+    ElaMessageBarLane& lane = _laneMap[laneKey];
+    int minimumHeightTotal = 0;
+    for (auto messageBar : lane.activeBarList)
+    {
+        minimumHeightTotal += messageBar->minimumHeight();
+    }
+    QString title = pendingData.title;
+    QString text = pendingData.text;
+    ElaMessageBar* messageBar = new ElaMessageBar(static_cast<ElaMessageBarType::PositionPolicy>(laneKey.second), pendingData.messageMode, title, text, pendingData.displayMsec, laneKey.first);
+    messageBar->d_ptr->_repeatCount = pendingData.repeatCount;
+    lane.activeBarList.append(messageBar);
+    messageBar->d_ptr->_messageBarCreate(messageBar->d_ptr->_calculateTargetPosY(minimumHeightTotal, lane.activeBarList.count() - 1));
 }
 
-void ElaMessageBarPrivate::tryToRequestMessageBarEvent()
+void ElaMessageBarManager::_dispatchPendingMessageBar(const LaneKey& laneKey)
 {
-    Q_Q(ElaMessageBar);
-    if (!_isMessageBarCreateAnimationFinished || _isMessageBarEventAnimationStart)
+    while (true)
     {
-        return;
+        auto laneIt = _laneMap.find(laneKey);
+        if (laneIt == _laneMap.end() || laneIt->pendingQueue.isEmpty())
+        {
+            return;
+        }
+        if (laneIt->activeBarList.count() >= _maximumVisibleCount || !_getIsLaneFitted(laneIt.value()))
+        {
+            return;
+        }
+        _showMessageBar(laneKey, laneIt->pendingQueue.dequeue());
     }
-    ElaMessageBarManager::getInstance()->requestMessageBarEvent(q);
 }
 
-WorkStatus ElaMessageBarPrivate::getWorkMode() const
+bool ElaMessageBarManager::_getIsLaneFitted(const ElaMessageBarLane& lane) const
 {
-    if (!_isMessageBarCreateAnimationFinished)
+    if (lane.activeBarList.isEmpty())
     {
-        return WorkStatus::CreateAnimation;
+        return true;
     }
-    if (_isMessageBarEventAnimationStart)
+    // 以末尾消息条的尺寸估算下一条的位置
+    ElaMessageBar* lastMessageBar = lane.activeBarList.last();
+    ElaMessageBarPrivate* lastMessageBarPrivate = lastMessageBar->d_ptr.data();
+    int minimumHeightTotal = 0;
+    for (auto messageBar : lane.activeBarList)
     {
-        return WorkStatus::OtherEventAnimation;
+        minimumHeightTotal += messageBar->minimumHeight();
     }
-    return WorkStatus::Idle;
+    qreal targetPosY = lastMessageBarPrivate->_calculateTargetPosY(minimumHeightTotal, lane.activeBarList.count());
+    int parentHeight = lastMessageBarPrivate->_parentWidget->height();
+    return targetPosY >= lastMessageBarPrivate->_messageBarVerticalTopMargin && targetPosY <= parentHeight - lastMessageBarPrivate->_messageBarVerticalBottomMargin - lastMessageBar->minimumHeight();
 }
 
-void ElaMessageBarPrivate::onOtherMessageBarEnd(QVariantMap eventData)
+void ElaMessageBarManager::_updateLaneLayout(const LaneKey& laneKey, bool isAnimated)
 {
-    Q_Q(ElaMessageBar);
-    _isMessageBarEventAnimationStart = true;
-    qreal targetPosY = eventData.value("TargetPosY").toReal();
-    QPropertyAnimation* closePosAnimation = new QPropertyAnimation(this, "MessageBarClosedY");
-    connect(closePosAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) { q->move(q->pos().x(), value.toUInt()); });
-    connect(closePosAnimation, &QPropertyAnimation::finished, this, [=]() {
-        _isMessageBarEventAnimationStart = false;
-        if (ElaMessageBarManager::getInstance()->getMessageBarEventCount(q) > 1)
+    auto laneIt = _laneMap.find(laneKey);
+    if (laneIt == _laneMap.end())
+    {
+        return;
+    }
+    QWidget* parentWidget = laneKey.first;
+    const char* animationKey = _getLayoutAnimationKey(laneKey.second);
+    eAnimationScheduler->stopAnimation(parentWidget, animationKey);
+    laneIt->layoutDataVector.clear();
+    int minimumHeightTotal = 0;
+    for (int i = 0; i < laneIt->activeBarList.count(); i++)
+    {
+        ElaMessageBar* messageBar = laneIt->activeBarList[i];
+        ElaMessageBarLayoutData layoutData;
+        layoutData.messageBar = messageBar;
+        layoutData.startY = messageBar->d_ptr->_layoutY;
+        layoutData.endY = messageBar->d_ptr->_calculateTargetPosY(minimumHeightTotal, i);
+        minimumHeightTotal += messageBar->minimumHeight();
+        if (isAnimated && layoutData.startY != layoutData.endY)
         {
-            ElaMessageBarManager::getInstance()->requestMessageBarEvent(q);
+            laneIt->layoutDataVector.append(layoutData);
         }
-        if (_isReadyToEnd)
+        else
         {
-            ElaMessageBarManager::getInstance()->requestMessageBarEvent(q);
+            messageBar->d_ptr->_layoutY = layoutData.endY;
+            messageBar->d_ptr->_updateMessageBarPos();
         }
-    });
-    closePosAnimation->setEasingCurve(QEasingCurve::InOutSine);
-    closePosAnimation->setDuration(200);
-    closePosAnimation->setStartValue(q->pos().y());
-    closePosAnimation->setEndValue(targetPosY);
-    closePosAnimation->start(QAbstractAnimation::DeleteWhenStopped);
+    }
+    if (laneIt->layoutDataVector.isEmpty())
+    {
+        return;
+    }
+    // 所有需移动的消息条共用一条动画
+    eAnimationScheduler->startAnimation(parentWidget, animationKey, 0, 1, 200, QEasingCurve::InOutSine, [=](qreal value) {
+        auto currentLaneIt = _laneMap.find(laneKey);
+        if (currentLaneIt == _laneMap.end())
+        {
+            return;
+        }
+        for (const auto& layoutData : currentLaneIt->layoutDataVector)
+        {
+            ElaMessageBarPrivate* messageBarPrivate = layoutData.messageBar->d_ptr.data();
+            messageBarPrivate->_layoutY = layoutData.startY + (layoutData.endY - layoutData.startY) * value;
+            messageBarPrivate->_updateMessageBarPos();
+        } });
 }
 
-void ElaMessageBarPrivate::messageBarEnd(QVariantMap eventData)
+void ElaMessageBarManager::_flushPostedMessageBar()
 {
-    Q_Q(ElaMessageBar);
-    ElaMessageBarManager::getInstance()->postMessageBarEndEvent(q);
-    QPropertyAnimation* barFinishedOpacityAnimation = new QPropertyAnimation(this, "pOpacity");
-    connect(barFinishedOpacityAnimation, &QPropertyAnimation::valueChanged, this, [=]() {
-        _closeButton->setOpacity(_pOpacity);
-        q->update();
-    });
-    connect(barFinishedOpacityAnimation, &QPropertyAnimation::finished, this, [=]() {
-        q->deleteLater();
-    });
-    barFinishedOpacityAnimation->setDuration(300);
-    barFinishedOpacityAnimation->setEasingCurve(QEasingCurve::InOutSine);
-    barFinishedOpacityAnimation->setStartValue(1);
-    barFinishedOpacityAnimation->setEndValue(0);
-    barFinishedOpacityAnimation->start(QAbstractAnimation::DeleteWhenStopped);
+    QVector<ElaMessageBarPostData> postDataVector;
+    _postMutex.lock();
+    postDataVector.swap(_postDataVector);
+    _isPostFlushScheduled = false;
+    _postMutex.unlock();
+    QWidget* defaultParent = nullptr;
+    // 父窗口只在GUI线程创建与销毁 此处以现存控件集合校验 已销毁的父窗口对应消息丢弃
+    QSet<QWidget*> liveWidgetSet;
+    for (const auto& postData : postDataVector)
+    {
+        if (postData.parentKey)
+        {
+            QWidgetList widgetList = QApplication::allWidgets();
+            liveWidgetSet.reserve(widgetList.count());
+            for (auto widget : widgetList)
+            {
+                liveWidgetSet.insert(widget);
+            }
+            break;
+        }
+    }
+    for (const auto& postData : postDataVector)
+    {
+        QWidget* parent = liveWidgetSet.contains(postData.parentKey) ? postData.parentKey : nullptr;
+        if (!postData.parentKey)
+        {
+            if (!defaultParent)
+            {
+                QList<QWidget*> widgetList = QApplication::topLevelWidgets();
+                for (auto widget : widgetList)
+                {
+                    if (widget->property("ElaBaseClassName").toString() == "ElaWindow")
+                    {
+                        defaultParent = widget;
+                    }
+                }
+            }
+            parent = defaultParent;
+        }
+        if (!parent)
+        {
+            continue;
+        }
+        // 合并数量经重复计数角标展示
+        postMessageBar(parent, postData.policy, postData.messageMode, postData.title, postData.text, postData.displayMsec, postData.postCount);
+    }
 }
 
-void ElaMessageBarPrivate::onCloseButtonClicked()
+void ElaMessageBarManager::_removeLane(const LaneKey& laneKey)
 {
-    Q_Q(ElaMessageBar);
-    if (_isReadyToEnd)
+    QWidget* parentWidget = laneKey.first;
+    eAnimationScheduler->stopAnimation(parentWidget, _getLayoutAnimationKey(laneKey.second));
+    _laneMap.remove(laneKey);
+    for (auto it = _laneMap.cbegin(); it != _laneMap.cend(); ++it)
     {
-        return;
+        if (it.key().first == parentWidget)
+        {
+            return;
+        }
     }
-    _isReadyToEnd = true;
-    _isNormalDisplay = false;
-    ElaMessageBarManager::getInstance()->forcePostMessageBarEndEvent(q);
-    QPropertyAnimation* opacityAnimation = new QPropertyAnimation(this, "pOpacity");
-    connect(opacityAnimation, &QPropertyAnimation::valueChanged, this, [=]() {
-        _closeButton->setOpacity(_pOpacity);
-        q->update();
-    });
-    connect(opacityAnimation, &QPropertyAnimation::finished, q, [=]() { q->deleteLater(); });
-    opacityAnimation->setStartValue(_pOpacity);
-    opacityAnimation->setEndValue(0);
-    opacityAnimation->setDuration(220);
-    opacityAnimation->setEasingCurve(QEasingCurve::InOutSine);
-    opacityAnimation->start(QAbstractAnimation::DeleteWhenStopped);
+    parentWidget->removeEventFilter(this);
+    disconnect(parentWidget, &QObject::destroyed, this, &ElaMessageBarManager::onParentDestroyed);
+}
+
+ElaMessageBarPrivate::ElaMessageBarPrivate(QObject* parent)
+    : QObject{parent}
+{
 }
 
-void ElaMessageBarPrivate::_messageBarCreate(int displayMsec)
+ElaMessageBarPrivate::~ElaMessageBarPrivate()
+{
+}
+
+void ElaMessageBarPrivate::onCloseButtonClicked()
+{
+    _messageBarEnd(220);
+}
+
+void ElaMessageBarPrivate::_messageBarCreate(qreal targetPosY)
 {
     Q_Q(ElaMessageBar);
-    q->show();
-    QFont font = q->font();
-    font.setPixelSize(16);
-    font.setWeight(QFont::Bold);
-    q->setFont(font);
-    int titleWidth = q->fontMetrics().horizontalAdvance(_title);
-    font.setPixelSize(14);
-    font.setWeight(QFont::Medium);
-    q->setFont(font);
-    int textWidth = q->fontMetrics().horizontalAdvance(_text);
-    int fixedWidth = _closeButtonLeftRightMargin + _leftPadding + _titleLeftSpacing + _textLeftSpacing + _closeButtonWidth + titleWidth + textWidth + 2 * _shadowBorderWidth;
-    q->setFixedWidth(fixedWidth > 500 ? 500 : fixedWidth);
-    ElaMessageBarManager::getInstance()->postMessageBarCreateEvent(q);
-    int startX = 0;
-    int startY = 0;
-    int endX = 0;
-    int endY = 0;
-    _calculateInitialPos(startX, startY, endX, endY);
+    _layoutY = targetPosY;
+    _displayTimer = new QTimer(this);
+    _displayTimer->setSingleShot(true);
+    connect(_displayTimer, &QTimer::timeout, this, [=]() {
+        _messageBarEnd(300);
+    });
     // 滑入动画
-    QPropertyAnimation* barPosAnimation = new QPropertyAnimation(q, "pos");
-    connect(barPosAnimation, &QPropertyAnimation::finished, q, [=]() {
-        _isNormalDisplay = true;
-        _isMessageBarCreateAnimationFinished = true;
-        if(ElaMessageBarManager::getInstance()->getMessageBarEventCount(q) > 1)
-        {
-            ElaMessageBarManager::getInstance()->requestMessageBarEvent(q);
-        }
-        QTimer::singleShot(displayMsec, q, [=]() {
-            _isReadyToEnd = true;
-            ElaMessageBarManager::getInstance()->requestMessageBarEvent(q);
-        }); });
+    int slideDuration = 450;
     switch (_policy)
     {
     case ElaMessageBarType::Top:
     case ElaMessageBarType::Bottom:
     {
-        barPosAnimation->setDuration(250);
+        slideDuration = 250;
         break;
     }
     default:
     {
-        barPosAnimation->setDuration(450);
         break;
     }
     }
-    barPosAnimation->setStartValue(QPoint(startX, startY));
-    barPosAnimation->setEndValue(QPoint(endX, endY));
-    barPosAnimation->setEasingCurve(QEasingCurve::InOutSine);
-    barPosAnimation->start(QAbstractAnimation::DeleteWhenStopped);
+    eAnimationScheduler->startAnimation(this, "SlideProgress", 0, 1, slideDuration, QEasingCurve::InOutSine, [=](qreal value) {
+        _slideProgress = value;
+        _updateMessageBarPos(); }, nullptr, [=]() {
+        _isNormalDisplay = true;
+        if (!_isReadyToEnd)
+        {
+            _displayTimer->start(_displayMsec);
+        } });
+    q->show();
 }
 
-void ElaMessageBarPrivate::_calculateInitialPos(int& startX, int& startY, int& endX, int& endY)
+void ElaMessageBarPrivate::_messageBarEnd(int duration)
 {
     Q_Q(ElaMessageBar);
-    QList<int> resultList = _getOtherMessageBarTotalData();
-    int minimumHeightTotal = resultList[0];
-    int indexLessCount = resultList[1];
-    switch (_policy)
-    {
-    case ElaMessageBarType::Top:
-    {
-        // 25动画距离
-        startX = q->parentWidget()->width() / 2 - q->minimumWidth() / 2;
-        startY = minimumHeightTotal + _messageBarSpacing * indexLessCount + _messageBarVerticalTopMargin - 25;
-        endX = startX;
-        endY = minimumHeightTotal + _messageBarSpacing * indexLessCount + _messageBarVerticalTopMargin;
-        break;
-    }
-    case ElaMessageBarType::Left:
-    {
-        startX = -q->minimumWidth();
-        startY = minimumHeightTotal + _messageBarSpacing * indexLessCount + q->parentWidget()->height() / 2;
-        endX = _messageBarHorizontalMargin;
-        endY = startY;
-        break;
-    }
-    case ElaMessageBarType::Bottom:
-    {
-        startX = q->parentWidget()->width() / 2 - q->minimumWidth() / 2;
-        startY = q->parentWidget()->height() - q->minimumHeight() - minimumHeightTotal - _messageBarSpacing * indexLessCount - _messageBarVerticalBottomMargin - 25;
-        endX = startX;
-        endY = q->parentWidget()->height() - q->minimumHeight() - minimumHeightTotal - _messageBarSpacing * indexLessCount - _messageBarVerticalBottomMargin;
-        break;
-    }
-    case ElaMessageBarType::Right:
-    {
-        startX = q->parentWidget()->width();
-        startY = minimumHeightTotal + _messageBarSpacing * indexLessCount + q->parentWidget()->height() / 2;
-        endX = q->parentWidget()->width() - q->minimumWidth() - _messageBarHorizontalMargin;
-        endY = startY;
-        break;
-    }
-    case ElaMessageBarType::TopRight:
-    {
-        startX = q->parentWidget()->width();
-        startY = minimumHeightTotal + _messageBarSpacing * indexLessCount + _messageBarVerticalTopMargin;
-        endX = q->parentWidget()->width() - q->minimumWidth() - _messageBarHorizontalMargin;
-        endY = startY;
-        break;
-    }
-    case ElaMessageBarType::TopLeft:
-    {
-        startX = -q->minimumWidth();
-        startY = minimumHeightTotal + _messageBarSpacing * indexLessCount + _messageBarVerticalTopMargin;
-        endX = _messageBarHorizontalMargin;
-        endY = startY;
-        break;
-    }
-    case ElaMessageBarType::BottomRight:
-    {
-        startX = q->parentWidget()->width();
-        startY = q->parentWidget()->height() - q->minimumHeight() - minimumHeightTotal - _messageBarSpacing * indexLessCount - _messageBarVerticalBottomMargin;
-        endX = q->parentWidget()->width() - q->minimumWidth() - _messageBarHorizontalMargin;
-        endY = startY;
-        break;
-    }
-    case ElaMessageBarType::BottomLeft:
-    {
-        startX = -q->minimumWidth();
-        startY = q->parentWidget()->height() - q->minimumHeight() - minimumHeightTotal - _messageBarSpacing * indexLessCount - _messageBarVerticalBottomMargin;
-        endX = _messageBarHorizontalMargin;
-        endY = startY;
-        break;
-    }
-    }
-    if (endY < _messageBarVerticalTopMargin || endY > q->parentWidget()->height() - _messageBarVerticalBottomMargin - q->minimumHeight())
+    if (_isReadyToEnd)
     {
-        ElaMessageBarManager::getInstance()->updateActiveMap(q, false);
-        q->deleteLater();
+        return;
     }
+    _isReadyToEnd = true;
+    _isNormalDisplay = false;
+    _displayTimer->stop();
+    ElaMessageBarManager::getInstance()->postMessageBarEndEvent(q);
+    eAnimationScheduler->startAnimation(this, "pOpacity", _pOpacity, 0, duration, QEasingCurve::InOutSine, [=](qreal value) {
+        _pOpacity = value;
+        _closeButton->setOpacity(_pOpacity); }, q, [=]() { q->deleteLater(); });
 }
 
-QList<int> ElaMessageBarPrivate::_getOtherMessageBarTotalData(bool isJudgeCreateOrder)
+void ElaMessageBarPrivate::_addRepeatCount(int repeatCount, int displayMsec)
 {
     Q_Q(ElaMessageBar);
-    QList<int> resultList;
-    int minimumHeightTotal = 0;
-    int indexLessCount = 0;
-    QList<ElaMessageBar*>* messageBarList = _messageBarActiveMap[_policy];
-    for (auto messageBar : *messageBarList)
+    _repeatCount += repeatCount;
+    _displayMsec = displayMsec;
+    // 重复消息重新计时
+    if (_displayTimer->isActive())
     {
-        if (messageBar == q)
-        {
-            continue;
-        }
-        if (!isJudgeCreateOrder || (isJudgeCreateOrder && _judgeCreateOrder(messageBar)))
-        {
-            indexLessCount++;
-            minimumHeightTotal += messageBar->minimumHeight();
-        }
+        _displayTimer->start(_displayMsec);
     }
-    resultList.append(minimumHeightTotal);
-    resultList.append(indexLessCount);
-    return resultList;
+    q->update();
 }
 
-qreal ElaMessageBarPrivate::_calculateTargetPosY()
+bool ElaMessageBarPrivate::_getIsSameMessage(ElaMessageBarType::MessageMode messageMode, const QString& title, const QString& text) const
 {
-    Q_Q(ElaMessageBar);
-    QList<int> resultList = _getOtherMessageBarTotalData(true);
-    int minimumHeightTotal = resultList[0];
-    int indexLessCount = resultList[1];
+    return _messageMode == messageMode && _title == title && _text == text;
+}
+
+qreal ElaMessageBarPrivate::_calculateTargetPosY(int minimumHeightTotal, int indexLessCount) const
+{
+    Q_Q(const ElaMessageBar);
     switch (_policy)
     {
     case ElaMessageBarType::Top:
@@ -433,29 +502,53 @@ qreal ElaMessageBarPrivate::_calculateTargetPosY()
     case ElaMessageBarType::Left:
     case ElaMessageBarType::Right:
     {
-        return minimumHeightTotal + _messageBarSpacing * indexLessCount + q->parentWidget()->height() / 2;
+        return minimumHeightTotal + _messageBarSpacing * indexLessCount + _parentWidget->height() / 2;
     }
     case ElaMessageBarType::Bottom:
     case ElaMessageBarType::BottomRight:
     case ElaMessageBarType::BottomLeft:
     {
-        return q->parentWidget()->height() - q->minimumHeight() - minimumHeightTotal - _messageBarSpacing * indexLessCount - _messageBarVerticalBottomMargin;
+        return _parentWidget->height() - q->minimumHeight() - minimumHeightTotal - _messageBarSpacing * indexLessCount - _messageBarVerticalBottomMargin;
     }
     }
     return 0;
 }
 
-bool ElaMessageBarPrivate::_judgeCreateOrder(ElaMessageBar* otherMessageBar)
+void ElaMessageBarPrivate::_updateMessageBarPos()
 {
-    if (otherMessageBar->d_ptr->_createTime < _createTime)
+    Q_Q(ElaMessageBar);
+    int parentWidth = _parentWidget->width();
+    qreal posX = 0;
+    qreal posY = _layoutY;
+    switch (_policy)
     {
-        //otherMessageBar先创建
-        return true;
+    case ElaMessageBarType::Top:
+    case ElaMessageBarType::Bottom:
+    {
+        // 25动画距离
+        posX = parentWidth / 2 - q->minimumWidth() / 2;
+        posY -= 25 * (1 - _slideProgress);
+        break;
     }
-    else
+    case ElaMessageBarType::Left:
+    case ElaMessageBarType::TopLeft:
+    case ElaMessageBarType::BottomLeft:
     {
-        return false;
+        qreal startX = -q->minimumWidth();
+        posX = startX + (_messageBarHorizontalMargin - startX) * _slideProgress;
+        break;
     }
+    case ElaMessageBarType::Right:
+    case ElaMessageBarType::TopRight:
+    case ElaMessageBarType::BottomRight:
+    {
+        qreal startX = parentWidth;
+        qreal endX = parentWidth - q->minimumWidth() - _messageBarHorizontalMargin;
+        posX = startX + (endX - startX) * _slideProgress;
+        break;
+    }
+    }
+    q->move(qRound(posX), qRound(posY));
 }
 
 void ElaMessageBarPrivate::_drawSuccess(QPainter* painter)
@@ -540,3 +633,24 @@ void ElaMessageBarPrivate::_drawError(QPainter* painter)
     // 文字颜色
     painter->setPen(Qt::black);
 }
+
+void ElaMessageBarPrivate::_drawRepeatCount(QPainter* painter)
+{
+    Q_Q(ElaMessageBar);
+    // 图标右上角重复次数角标
+    QString countText = _repeatCount > 99 ? QStringLiteral("99+") : QString::number(_repeatCount);
+    painter->save();
+    QFont font = q->font();
+    font.setPixelSize(10);
+    font.setWeight(QFont::Bold);
+    painter->setFont(font);
+    qreal badgeHeight = 14;
+    qreal badgeWidth = qMax(badgeHeight, painter->fontMetrics().horizontalAdvance(countText) + 8.0);
+    QRectF badgeRect(_leftPadding + 10, q->height() / 2 - 9 - badgeHeight / 2, badgeWidth, badgeHeight);
+    painter->setPen(Qt::NoPen);
+    painter->setBrush(QColor(0xC4, 0x2B, 0x1C));
+    painter->drawRoundedRect(badgeRect, badgeHeight / 2, badgeHeight / 2);
+    painter->setPen(Qt::white);
+    painter->drawText(badgeRect, Qt::AlignCenter, countText);
+    painter->restore();
+}
@@ -1,23 +1,55 @@
 #ifndef ELAMESSAGEBARPRIVATE_H
 #define ELAMESSAGEBARPRIVATE_H
 
-#include <QMap>
+#include <QHash>
+#include <QMutex>
 #include <QObject>
+#include <QPair>
 #include <QQueue>
-#include <QVariantMap>
+#include <QVector>
 
 #include "Def.h"
 #include "singleton.h"
 #include "stdafx.h"
 
-enum WorkStatus
+struct ElaMessageBarPendingData
 {
-    Idle = 0x0000,
-    CreateAnimation = 0x0001,
-    OtherEventAnimation = 0x0002,
+    ElaMessageBarType::MessageMode messageMode{ElaMessageBarType::Success};
+    QString title;
+    QString text;
+    int displayMsec{0};
+    int repeatCount{1};
+};
+
+// 跨线程投递的消息 同一(类型, 策略, 父窗口)在聚合窗口内合并为一条
+// 投递线程只记录父窗口地址 存活性在GUI线程刷新时检查
+struct ElaMessageBarPostData
+{
+    QWidget* parentKey{nullptr};
+    ElaMessageBarType::PositionPolicy policy{ElaMessageBarType::Top};
+    ElaMessageBarType::MessageMode messageMode{ElaMessageBarType::Success};
+    QString title;
+    QString text;
+    int displayMsec{0};
+    int postCount{0};
 };
 
 class ElaMessageBar;
+struct ElaMessageBarLayoutData
+{
+    ElaMessageBar* messageBar{nullptr};
+    qreal startY{0};
+    qreal endY{0};
+};
+
+// 同一父窗口同一策略下的消息队列 activeBarList按创建次序排列
+struct ElaMessageBarLane
+{
+    QList<ElaMessageBar*> activeBarList;
+    QQueue<ElaMessageBarPendingData> pendingQueue;
+    QVector<ElaMessageBarLayoutData> layoutDataVector;
+};
+
 class ElaMessageBarManager : public QObject
 {
     Q_OBJECT
@@ -27,25 +59,44 @@ private:
     ~ElaMessageBarManager();
 
 public:
-    //请求事件堆栈调用
-    void requestMessageBarEvent(ElaMessageBar* messageBar);
-    //发布创建事件
-    void postMessageBarCreateEvent(ElaMessageBar* messageBar);
-    //发布终止事件
+    //发布消息 与显示中或排队中的相同消息合并计数 超出可见上限时排队
+    void postMessageBar(QWidget* parent, ElaMessageBarType::PositionPolicy policy, ElaMessageBarType::MessageMode messageMode, const QString& title, const QString& text, int displayMsec, int repeatCount = 1);
+    //任意线程调用 聚合窗口结束后在GUI线程统一发布
+    void postMessageBarAsync(QWidget* parent, ElaMessageBarType::PositionPolicy policy, ElaMessageBarType::MessageMode messageMode, const QString& title, const QString& text, int displayMsec);
+    //发布终止事件 立即让出位置并统一布局
     void postMessageBarEndEvent(ElaMessageBar* messageBar);
-    //强制发布终止事件
-    void forcePostMessageBarEndEvent(ElaMessageBar* messageBar);
-    //获取当前事件数量
-    int getMessageBarEventCount(ElaMessageBar* messageBar);
-    //更新活动序列
-    void updateActiveMap(ElaMessageBar* messageBar, bool isActive);
+    //析构时移除
+    void removeMessageBar(ElaMessageBar* messageBar);
+    void setMaximumVisibleCount(int count);
+    int getMaximumVisibleCount() const;
+    void setAggregationWindow(int msec);
+    int getAggregationWindow() const;
+    Q_SLOT void onParentDestroyed(QObject* parent);
+
+protected:
+    virtual bool eventFilter(QObject* watched, QEvent* event) override;
 
 private:
-    QMap<ElaMessageBar*, QList<QVariantMap>> _messageBarEventMap;
+    using LaneKey = QPair<QWidget*, int>;
+    QHash<LaneKey, ElaMessageBarLane> _laneMap;
+    int _maximumVisibleCount{5};
+    int _maximumPendingCount{100};
+    mutable QMutex _postMutex;
+    QVector<ElaMessageBarPostData> _postDataVector;
+    bool _isPostFlushScheduled{false};
+    int _aggregationWindow{1000};
+    void _flushPostedMessageBar();
+    LaneKey _getLaneKey(ElaMessageBar* messageBar) const;
+    void _showMessageBar(const LaneKey& laneKey, const ElaMessageBarPendingData& pendingData);
+    void _dispatchPendingMessageBar(const LaneKey& laneKey);
+    bool _getIsLaneFitted(const ElaMessageBarLane& lane) const;
+    void _updateLaneLayout(const LaneKey& laneKey, bool isAnimated);
+    void _removeLane(const LaneKey& laneKey);
 };
 
 class ElaIconButton;
 class QPainter;
+class QTimer;
 class ElaMessageBarPrivate : public QObject
 {
     Q_OBJECT
@@ -54,10 +105,6 @@ class ElaMessageBarPrivate : public QObject
 public:
     explicit ElaMessageBarPrivate(QObject* parent = nullptr);
     ~ElaMessageBarPrivate();
-    void tryToRequestMessageBarEvent();
-    WorkStatus getWorkMode() const;
-    Q_INVOKABLE void onOtherMessageBarEnd(QVariantMap eventData);
-    Q_INVOKABLE void messageBarEnd(QVariantMap eventData);
     Q_SLOT void onCloseButtonClicked();
 
 private:
@@ -68,7 +115,9 @@ private:
     QString _text{""};
     ElaMessageBarType::PositionPolicy _policy;
     ElaMessageBarType::MessageMode _messageMode;
-    qreal _createTime{0};
+    QWidget* _parentWidget{nullptr};
+    int _displayMsec{0};
+    int _repeatCount{1};
 
     // 位置数据
     int _leftPadding{20};                // 左边框到图标中心
@@ -81,30 +130,30 @@ private:
     int _messageBarVerticalTopMargin{50};
     int _messageBarSpacing{15};
     int _shadowBorderWidth{6};
+    qreal _layoutY{0};
+    qreal _slideProgress{1};
 
     // 逻辑数据
-    bool _isMessageBarCreateAnimationFinished{false};
     bool _isReadyToEnd{false};
     bool _isNormalDisplay{false};
-    bool _isMessageBarEventAnimationStart{false};
     ElaIconButton* _closeButton{nullptr};
-    Q_INVOKABLE void _messageBarCreate(int displayMsec);
+    QTimer* _displayTimer{nullptr};
+    void _messageBarCreate(qreal targetPosY);
+    void _messageBarEnd(int duration);
+    void _addRepeatCount(int repeatCount, int displayMsec);
+    bool _getIsSameMessage(ElaMessageBarType::MessageMode messageMode, const QString& title, const QString& text) const;
 
-    // 初始坐标计算
-    void _calculateInitialPos(int& startX, int& startY, int& endX, int& endY);
-    //获取总高度和次序信息
-    QList<int> _getOtherMessageBarTotalData(bool isJudgeCreateOrder = false);
     //计算目标坐标
-    qreal _calculateTargetPosY();
-
-    //创建次序判断
-    bool _judgeCreateOrder(ElaMessageBar* otherMessageBar);
+    qreal _calculateTargetPosY(int minimumHeightTotal, int indexLessCount) const;
+    //按布局坐标与滑入进度更新位置
+    void _updateMessageBarPos();
 
     // 绘制函数
     void _drawSuccess(QPainter* painter);
     void _drawWarning(QPainter* painter);
     void _drawInformation(QPainter* painter);
     void _drawError(QPainter* painter);
+    void _drawRepeatCount(QPainter* painter);
 };
 
 #endif // ELAMESSAGEBARPRIVATE_H
@@ -2,6 +2,7 @@
 
 #include <QPropertyAnimation>
 
+#include "ElaApplication.h"
 #include "ElaComboBoxView.h"
 #include "ElaMultiSelectComboBox.h"
 ElaMultiSelectComboBoxPrivate::ElaMultiSelectComboBoxPrivate(QObject* parent)
@@ -29,7 +30,7 @@ void ElaMultiSelectComboBoxPrivate::onItemPressed(const QModelIndex& index)
     connect(markAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) {
         q->update();
     });
-    markAnimation->setDuration(300);
+    markAnimation->setDuration(eApp->getAnimationDuration(300));
     markAnimation->setEasingCurve(QEasingCurve::InOutSine);
     markAnimation->setStartValue(_pExpandMarkWidth);
     qreal step = (q->width() / 2 - _pBorderRadius) / q->count();
@@ -541,7 +541,7 @@ void ElaNavigationBarPrivate::_doNavigationBarWidthAnimation(ElaNavigationType::
     QPropertyAnimation* navigationBarWidthAnimation = new QPropertyAnimation(q, "maximumWidth");
     navigationBarWidthAnimation->setEasingCurve(QEasingCurve::OutCubic);
     navigationBarWidthAnimation->setStartValue(q->width());
-    navigationBarWidthAnimation->setDuration(isAnimation ? 285 : 0);
+    navigationBarWidthAnimation->setDuration(eApp->getAnimationDuration(isAnimation ? 285 : 0));
     switch (displayMode)
     {
     case ElaNavigationType::Minimal:
@@ -588,7 +588,7 @@ void ElaNavigationBarPrivate::_doNavigationViewWidthAnimation(bool isAnimation)
     navigationViewWidthAnimation->setEasingCurve(QEasingCurve::OutCubic);
     navigationViewWidthAnimation->setStartValue(_navigationView->columnWidth(0));
     navigationViewWidthAnimation->setEndValue(40);
-    navigationViewWidthAnimation->setDuration(isAnimation ? 285 : 0);
+    navigationViewWidthAnimation->setDuration(eApp->getAnimationDuration(isAnimation ? 285 : 0));
     navigationViewWidthAnimation->start(QAbstractAnimation::DeleteWhenStopped);
 }
 
@@ -612,7 +612,7 @@ void ElaNavigationBarPrivate::_doNavigationButtonAnimation(bool isCompact, bool
             navigationButtonAnimation->setEndValue(navigationButtonPos);
         }
         navigationButtonAnimation->setEasingCurve(QEasingCurve::OutCubic);
-        navigationButtonAnimation->setDuration(isAnimation ? 285 : 0);
+        navigationButtonAnimation->setDuration(eApp->getAnimationDuration(isAnimation ? 285 : 0));
         navigationButtonAnimation->start(QAbstractAnimation::DeleteWhenStopped);
     }
     else
@@ -629,7 +629,7 @@ void ElaNavigationBarPrivate::_doNavigationButtonAnimation(bool isCompact, bool
             navigationButtonAnimation->setEndValue(navigationButtonPos);
         }
         navigationButtonAnimation->setEasingCurve(QEasingCurve::InOutSine);
-        navigationButtonAnimation->setDuration(isAnimation ? 130 : 0);
+        navigationButtonAnimation->setDuration(eApp->getAnimationDuration(isAnimation ? 130 : 0));
         navigationButtonAnimation->start(QAbstractAnimation::DeleteWhenStopped);
     }
 }
@@ -652,7 +652,7 @@ void ElaNavigationBarPrivate::_doSearchButtonAnimation(bool isCompact, bool isAn
             searchButtonAnimation->setEndValue(QPoint(0, navigationButtonPos.y() + 38));
         }
         searchButtonAnimation->setEasingCurve(QEasingCurve::OutCubic);
-        searchButtonAnimation->setDuration(isAnimation ? 285 : 0);
+        searchButtonAnimation->setDuration(eApp->getAnimationDuration(isAnimation ? 285 : 0));
         searchButtonAnimation->start(QAbstractAnimation::DeleteWhenStopped);
         _searchButton->setVisible(true);
     }
@@ -678,7 +678,7 @@ void ElaNavigationBarPrivate::_doUserButtonAnimation(bool isCompact, bool isAnim
         userButtonAnimation->setEasingCurve(QEasingCurve::OutCubic);
         userButtonAnimation->setStartValue(QRect(13, 18, 64, 64));
         userButtonAnimation->setEndValue(QRect(3, 10, 36, 36));
-        userButtonAnimation->setDuration(isAnimation ? 285 : 0);
+        userButtonAnimation->setDuration(eApp->getAnimationDuration(isAnimation ? 285 : 0));
         userButtonAnimation->start(QAbstractAnimation::DeleteWhenStopped);
     }
     else
@@ -699,7 +699,7 @@ void ElaNavigationBarPrivate::_doUserButtonAnimation(bool isCompact, bool isAnim
         userButtonAnimation->setEasingCurve(QEasingCurve::InOutSine);
         userButtonAnimation->setStartValue(QRect(3, 10, 36, 36));
         userButtonAnimation->setEndValue(QRect(13, 18, 64, 64));
-        userButtonAnimation->setDuration(isAnimation ? 130 : 0);
+        userButtonAnimation->setDuration(eApp->getAnimationDuration(isAnimation ? 130 : 0));
         userButtonAnimation->start(QAbstractAnimation::DeleteWhenStopped);
     }
 }
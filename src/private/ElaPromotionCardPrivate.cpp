@@ -4,6 +4,7 @@
 #include <QPropertyAnimation>
 #include <QtMath>
 
+#include "ElaApplication.h"
 #include "ElaPromotionCard.h"
 ElaPromotionCardPrivate::ElaPromotionCardPrivate(QObject* parent)
     : QObject{parent}
@@ -38,7 +39,7 @@ void ElaPromotionCardPrivate::_startHoverOpacityAnimation(bool isVisible)
     connect(opacityAnimation, &QPropertyAnimation::valueChanged, this, [=](const QVariant& value) {
         q->update();
     });
-    opacityAnimation->setDuration(250);
+    opacityAnimation->setDuration(eApp->getAnimationDuration(250, true));
     opacityAnimation->setStartValue(_pHoverOpacity);
     opacityAnimation->setEndValue(isVisible ? 1 : 0);
     opacityAnimation->start(QAbstractAnimation::DeleteWhenStopped);
@@ -2,6 +2,7 @@
 
 #include <QPropertyAnimation>
 
+#include "ElaApplication.h"
 #include "ElaPromotionCard.h"
 #include "ElaPromotionView.h"
 ElaPromotionViewPrivate::ElaPromotionViewPrivate(QObject* parent)
@@ -25,13 +26,14 @@ void ElaPromotionViewPrivate::onPromotionCardClicked(ElaPromotionCard* clickedCa
     //卡片移动动画
     bool isRightToLeft = _promotionCardList[oldCurrentIndex]->x() < _promotionCardList[newCurrentIndex]->x();
     int originIndex = _getAdjacentIndex(Qt::RightToLeft, newCurrentIndex);
+    int animationDuration = eApp->getAnimationDuration(650);
     for (int i = 0; i < _promotionCardList.count(); i++)
     {
         ElaPromotionCard* card = _promotionCardList[originIndex];
         QPropertyAnimation* geometryAnimation = new QPropertyAnimation(card, "geometry");
         QRect geometry = card->geometry();
         geometryAnimation->setEasingCurve(QEasingCurve::OutCubic);
-        geometryAnimation->setDuration(650);
+        geometryAnimation->setDuration(animationDuration);
         geometryAnimation->setStartValue(geometry);
         if (i == 0)
         {
@@ -39,7 +41,7 @@ void ElaPromotionViewPrivate::onPromotionCardClicked(ElaPromotionCard* clickedCa
             QRect targetGeometry(-_pCardCollapseWidth + _leftPadding, 0, _pCardCollapseWidth, q->height() - _bottomMargin);
             if (_promotionCardList.count() > 2)
             {
-                if (!isRightToLeft)
+                if (!isRightToLeft && animationDuration > 0)
                 {
                     geometryAnimation->setKeyValueAt(0.7, QRect(geometry.x() + _pCardCollapseWidth * 0.7 + _cardSpacing, 0, _pCardCollapseWidth, q->height() - _bottomMargin));
                     geometryAnimation->setKeyValueAt(0.71, QRect(-_pCardCollapseWidth, 0, _pCardCollapseWidth, q->height() - _bottomMargin));
@@ -68,13 +70,13 @@ void ElaPromotionViewPrivate::onPromotionCardClicked(ElaPromotionCard* clickedCa
         else
         {
             QRect targetGeometry(_leftPadding + _pCardExpandWidth + _cardSpacing * i + _pCardCollapseWidth * (i - 2), 0, _pCardCollapseWidth, q->height() - _bottomMargin);
-            if (isRightToLeft && targetGeometry.x() > card->x())
+            if (isRightToLeft && targetGeometry.x() > card->x() && animationDuration > 0)
             {
                 connect(geometryAnimation, &QPropertyAnimation::valueChanged, this, [=]() {
                     if (card->geometry().right() <= 0)
                     {
                         geometryAnimation->pause();
-                        qreal timeRatio = geometryAnimation->currentTime() / 650.0;
+                        qreal timeRatio = geometryAnimation->currentTime() / static_cast<qreal>(animationDuration);
                         geometryAnimation->setKeyValueAt(timeRatio, QRect(_promotionCardList[_getAdjacentIndex(Qt::RightToLeft, originIndex)]->geometry().right() + _pCardCollapseWidth * (1 - timeRatio), 0, _pCardCollapseWidth, q->height() - _bottomMargin));
                         geometryAnimation->setEndValue(targetGeometry);
                         geometryAnimation->resume();
@@ -100,7 +102,7 @@ void ElaPromotionViewPrivate::_startCardGeometryAnimation(ElaPromotionCard* card
 {
     QPropertyAnimation* geometryAnimation = new QPropertyAnimation(card, "geometry");
     geometryAnimation->setEasingCurve(QEasingCurve::OutCubic);
-    geometryAnimation->setDuration(650);
+    geometryAnimation->setDuration(eApp->getAnimationDuration(650));
     geometryAnimation->setStartValue(start);
     geometryAnimation->setEndValue(end);
     geometryAnimation->start(QAbstractAnimation::DeleteWhenStopped);
@@ -110,7 +112,7 @@ void ElaPromotionViewPrivate::_startHorizontalCardPixmapRatioAnimation(ElaPromot
 {
     QPropertyAnimation* ratioAnimation = new QPropertyAnimation(card, "pHorizontalCardPixmapRatio");
     ratioAnimation->setEasingCurve(QEasingCurve::OutCubic);
-    ratioAnimation->setDuration(650);
+    ratioAnimation->setDuration(eApp->getAnimationDuration(650));
     ratioAnimation->setStartValue(start);
     ratioAnimation->setEndValue(end);
     ratioAnimation->start(QAbstractAnimation::DeleteWhenStopped);
@@ -4,6 +4,7 @@
 #include <QPropertyAnimation>
 #include <QStyleOption>
 
+#include "ElaApplication.h"
 #include "ElaScrollBar.h"
 ElaScrollBarPrivate::ElaScrollBarPrivate(QObject* parent)
     : QObject{parent}
@@ -30,7 +31,7 @@ void ElaScrollBarPrivate::onRangeChanged(int min, int max)
             q->update();
         });
         rangeSmoothAnimation->setEasingCurve(QEasingCurve::OutSine);
-        rangeSmoothAnimation->setDuration(250);
+        rangeSmoothAnimation->setDuration(eApp->getAnimationDuration(250));
         rangeSmoothAnimation->setStartValue(_pTargetMaximum);
         rangeSmoothAnimation->setEndValue(max);
         rangeSmoothAnimation->start(QAbstractAnimation::DeleteWhenStopped);
@@ -66,6 +67,8 @@ void ElaScrollBarPrivate::_scroll(Qt::KeyboardModifiers modifiers, int delta)
     }
     _scrollValue -= stepsToScroll;
     _slideSmoothAnimation->stop();
+    // 每次启动时读取 动画策略可在运行时切换
+    _slideSmoothAnimation->setDuration(eApp->getAnimationDuration(300));
     _slideSmoothAnimation->setStartValue(q->value());
     _slideSmoothAnimation->setEndValue(_scrollValue);
     _slideSmoothAnimation->start();
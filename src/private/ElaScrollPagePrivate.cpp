@@ -5,6 +5,7 @@
 #include <QStackedWidget>
 #include <QTimer>
 
+#include "ElaApplication.h"
 #include "ElaBreadcrumbBar.h"
 #include "ElaScrollPage.h"
 
@@ -39,6 +40,12 @@ void ElaScrollPagePrivate::onNavigationRouteBack(QVariantMap routeData)
 
 void ElaScrollPagePrivate::_switchCentralStackIndex(int targetIndex, int lastIndex)
 {
+    int animationDuration = eApp->getAnimationDuration(280);
+    if (animationDuration == 0)
+    {
+        _centralStackedWidget->setCurrentIndex(targetIndex);
+        return;
+    }
     QWidget* currentWidget = _centralStackedWidget->widget(lastIndex);
     QWidget* targetWidget = _centralStackedWidget->widget(targetIndex);
     targetWidget->resize(currentWidget->size());
@@ -46,14 +53,14 @@ void ElaScrollPagePrivate::_switchCentralStackIndex(int targetIndex, int lastInd
 
     QPropertyAnimation* currentWidgetAnimation = new QPropertyAnimation(currentWidget, "pos");
     currentWidgetAnimation->setEasingCurve(QEasingCurve::InQuart);
-    currentWidgetAnimation->setDuration(280);
+    currentWidgetAnimation->setDuration(animationDuration);
 
     QPropertyAnimation* targetWidgetAnimation = new QPropertyAnimation(targetWidget, "pos");
     connect(targetWidgetAnimation, &QPropertyAnimation::finished, this, [=]() {
         _centralStackedWidget->setCurrentIndex(targetIndex);
     });
     targetWidgetAnimation->setEasingCurve(QEasingCurve::InQuart);
-    targetWidgetAnimation->setDuration(280);
+    targetWidgetAnimation->setDuration(animationDuration);
     if (targetIndex > lastIndex)
     {
         //左滑
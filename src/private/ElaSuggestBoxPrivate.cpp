@@ -2,28 +2,20 @@
 
 #include <QLayout>
 #include <QPropertyAnimation>
+#include <QTimer>
 
+#include "ElaApplication.h"
 #include "ElaBaseListView.h"
 #include "ElaLineEdit.h"
 #include "ElaSuggestBox.h"
 #include "ElaSuggestBoxSearchViewContainer.h"
 #include "ElaSuggestModel.h"
-
-ElaSuggestion::ElaSuggestion(QObject* parent)
-    : QObject(parent)
-{
-    _pElaIcon = ElaIconType::None;
-    _pSuggestText = "";
-    _pSuggestData = QVariantMap();
-}
-
-ElaSuggestion::~ElaSuggestion()
-{
-}
+#include "ElaSuggestProviderWorker.h"
 
 ElaSuggestBoxPrivate::ElaSuggestBoxPrivate(QObject* parent)
     : QObject{parent}
 {
+    _suggestCache.setMaxCost(64);
 }
 
 ElaSuggestBoxPrivate::~ElaSuggestBoxPrivate()
@@ -40,24 +32,80 @@ void ElaSuggestBoxPrivate::onThemeModeChanged(ElaThemeType::ThemeMode themeMode)
 
 void ElaSuggestBoxPrivate::onSearchEditTextEdit(const QString& searchText)
 {
-    Q_Q(ElaSuggestBox);
     if (searchText.isEmpty())
     {
+        _cancelProviderQuery();
         _startCloseAnimation();
         return;
     }
-    QVector<ElaSuggestion*> suggestionVector;
-    for (const auto& suggest : _suggestionVector)
+    if (_suggestProvider)
     {
-        if (suggest->getSuggestText().contains(searchText, _pCaseSensitivity))
+        QVector<ElaSuggestResult> cachedVector;
+        if (_findCachedSuggestion(searchText, cachedVector))
         {
-            suggestionVector.append(suggest);
+            _cancelProviderQuery();
+            _updateProviderSuggestion(cachedVector);
+            return;
         }
+        _pendingQueryText = searchText;
+        _debounceTimer->start(_pDebounceMsec);
+        return;
+    }
+    _updateSearchView(&_suggestionStore, _suggestionStore.searchSuggestion(searchText, _pCaseSensitivity));
+}
+
+void ElaSuggestBoxPrivate::onSearchViewClicked(const QModelIndex& index)
+{
+    Q_Q(ElaSuggestBox);
+    // clear不触发textEdited 在此取消未完成的查询
+    _searchEdit->clear();
+    _cancelProviderQuery();
+    _searchView->clearSelection();
+    if (!index.isValid())
+    {
+        return;
+    }
+    Q_EMIT q->suggestionClicked(_searchModel->getSuggestText(index.row()), _searchModel->getSuggestData(index.row()));
+    _startCloseAnimation();
+}
+
+void ElaSuggestBoxPrivate::onDebounceTimeout()
+{
+    if (!_suggestProvider || _pendingQueryText.isEmpty())
+    {
+        return;
+    }
+    _currentRequestID = _providerWorker->requestQuery();
+    Q_EMIT querySuggestion(_currentRequestID, _pendingQueryText, _pCaseSensitivity, _pMaxSuggestCount);
+    _pendingQueryText.clear();
+}
+
+void ElaSuggestBoxPrivate::onQuerySuggestionFinished(quint64 requestID, QString queryText, QVector<ElaSuggestResult> suggestionVector)
+{
+    if (requestID != _currentRequestID || !_suggestProvider)
+    {
+        return;
+    }
+    // 非零表示仍有查询未返回
+    _currentRequestID = 0;
+    ElaSuggestCacheData* cacheData = new ElaSuggestCacheData();
+    cacheData->suggestionVector = suggestionVector;
+    cacheData->isTruncated = suggestionVector.count() >= _pMaxSuggestCount;
+    _suggestCache.insert(_getCacheKey(queryText), cacheData);
+    if (_searchEdit->text().isEmpty())
+    {
+        return;
     }
-    if (!suggestionVector.isEmpty())
+    _updateProviderSuggestion(suggestionVector);
+}
+
+void ElaSuggestBoxPrivate::_updateSearchView(const ElaSuggestionStore* suggestionStore, const QVector<int>& rowVector)
+{
+    Q_Q(ElaSuggestBox);
+    if (!rowVector.isEmpty())
     {
-        _searchModel->setSearchSuggestion(suggestionVector);
-        int rowCount = suggestionVector.count();
+        _searchModel->setSearchSuggestion(suggestionStore, rowVector);
+        int rowCount = rowVector.count();
         if (rowCount > 4)
         {
             rowCount = 4;
@@ -87,18 +135,89 @@ void ElaSuggestBoxPrivate::onSearchEditTextEdit(const QString& searchText)
     }
 }
 
-void ElaSuggestBoxPrivate::onSearchViewClicked(const QModelIndex& index)
+void ElaSuggestBoxPrivate::_updateProviderSuggestion(const QVector<ElaSuggestResult>& suggestionVector)
 {
-    Q_Q(ElaSuggestBox);
-    _searchEdit->clear();
-    _searchView->clearSelection();
-    if (!index.isValid())
+    if (suggestionVector.isEmpty())
     {
+        _startCloseAnimation();
         return;
     }
-    ElaSuggestion* suggest = _searchModel->getSearchSuggestion(index.row());
-    Q_EMIT q->suggestionClicked(suggest->getSuggestText(), suggest->getSuggestData());
-    _startCloseAnimation();
+    // 仅保存当前展示的结果 模型随后立即重置
+    _providerSuggestionStore.clear();
+    _providerSuggestionStore.reserve(suggestionVector.count());
+    QVector<int> rowVector;
+    rowVector.reserve(suggestionVector.count());
+    for (const auto& result : suggestionVector)
+    {
+        rowVector.append(_providerSuggestionStore.appendSuggestion(result.icon, result.suggestText, result.suggestData));
+    }
+    _updateSearchView(&_providerSuggestionStore, rowVector);
+}
+
+void ElaSuggestBoxPrivate::_releaseProviderSuggestion()
+{
+    _providerSuggestionStore.clear();
+}
+
+void ElaSuggestBoxPrivate::_refreshLocalSuggestion()
+{
+    // 删除后行号失效 正在展示本地建议时重新检索
+    if (_suggestProvider || !_searchViewBaseWidget->isVisible())
+    {
+        return;
+    }
+    onSearchEditTextEdit(_searchEdit->text());
+}
+
+QString ElaSuggestBoxPrivate::_getCacheKey(const QString& queryText) const
+{
+    return _pCaseSensitivity == Qt::CaseSensitive ? QString("S") + queryText : QString("I") + queryText.toLower();
+}
+
+bool ElaSuggestBoxPrivate::_findCachedSuggestion(const QString& queryText, QVector<ElaSuggestResult>& suggestionVector)
+{
+    ElaSuggestCacheData* cacheData = _suggestCache.object(_getCacheKey(queryText));
+    if (cacheData)
+    {
+        suggestionVector = cacheData->suggestionVector;
+        return true;
+    }
+    // 前缀的完整结果可直接过滤得到当前结果 无需再次查询数据源
+    for (int i = queryText.length() - 1; i > 0; i--)
+    {
+        ElaSuggestCacheData* prefixData = _suggestCache.object(_getCacheKey(queryText.left(i)));
+        if (!prefixData || prefixData->isTruncated)
+        {
+            continue;
+        }
+        suggestionVector.clear();
+        for (const auto& suggestion : prefixData->suggestionVector)
+        {
+            if (_suggestProvider->isSuggestionMatched(suggestion, queryText, _pCaseSensitivity))
+            {
+                suggestionVector.append(suggestion);
+            }
+        }
+        ElaSuggestCacheData* refinedData = new ElaSuggestCacheData();
+        refinedData->suggestionVector = suggestionVector;
+        _suggestCache.insert(_getCacheKey(queryText), refinedData);
+        return true;
+    }
+    return false;
+}
+
+void ElaSuggestBoxPrivate::_cancelProviderQuery()
+{
+    if (_debounceTimer)
+    {
+        _debounceTimer->stop();
+    }
+    _pendingQueryText.clear();
+    if (_providerWorker)
+    {
+        _providerWorker->cancelQuery();
+    }
+    _currentRequestID = 0;
 }
 
 void ElaSuggestBoxPrivate::_startSizeAnimation(QSize oldSize, QSize newSize)
@@ -115,7 +234,7 @@ void ElaSuggestBoxPrivate::_startSizeAnimation(QSize oldSize, QSize newSize)
     connect(expandAnimation, &QPropertyAnimation::finished, this, [=]() {
         _shadowLayout->addWidget(_searchView);
     });
-    expandAnimation->setDuration(300);
+    expandAnimation->setDuration(eApp->getAnimationDuration(300));
     expandAnimation->setEasingCurve(QEasingCurve::InOutSine);
     expandAnimation->setStartValue(oldSize);
     expandAnimation->setEndValue(newSize);
@@ -136,7 +255,7 @@ void ElaSuggestBoxPrivate::_startExpandAnimation()
         _isExpandAnimationFinished = true;
         _searchView->clearSelection();
     });
-    expandAnimation->setDuration(300);
+    expandAnimation->setDuration(eApp->getAnimationDuration(300));
     expandAnimation->setEasingCurve(QEasingCurve::InOutSine);
     expandAnimation->setStartValue(_searchView->pos());
     expandAnimation->setEndValue(QPoint(8, 8));
@@ -152,21 +271,22 @@ void ElaSuggestBoxPrivate::_startCloseAnimation()
     _isExpandAnimationFinished = true;
     _isCloseAnimationFinished = false;
     QPropertyAnimation* baseWidgetsAnimation = new QPropertyAnimation(_searchViewBaseWidget, "size");
-    baseWidgetsAnimation->setDuration(300);
+    baseWidgetsAnimation->setDuration(eApp->getAnimationDuration(300));
     baseWidgetsAnimation->setEasingCurve(QEasingCurve::InOutSine);
     baseWidgetsAnimation->setStartValue(_searchViewBaseWidget->size());
-    baseWidgetsAnimation->setEndValue(QSize(_searchViewBaseWidget->width(), 0));
+    _lastSize = QSize(_searchViewBaseWidget->width(), 0);
+    baseWidgetsAnimation->setEndValue(_lastSize);
     baseWidgetsAnimation->start(QAbstractAnimation::DeleteWhenStopped);
     QPropertyAnimation* closeAnimation = new QPropertyAnimation(_searchView, "pos");
     connect(closeAnimation, &QPropertyAnimation::finished, this, [=]() {
         _isCloseAnimationFinished = true;
         _searchModel->clearSearchNode();
+        _releaseProviderSuggestion();
         _searchViewBaseWidget->hide();
     });
-    closeAnimation->setDuration(300);
+    closeAnimation->setDuration(eApp->getAnimationDuration(300));
     closeAnimation->setEasingCurve(QEasingCurve::InOutSine);
     closeAnimation->setStartValue(_searchView->pos());
     closeAnimation->setEndValue(QPoint(_searchView->pos().x(), -_searchView->height()));
     closeAnimation->start(QAbstractAnimation::DeleteWhenStopped);
-    _lastSize = baseWidgetsAnimation->endValue().toSize();
 }
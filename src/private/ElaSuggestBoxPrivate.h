@@ -2,24 +2,24 @@
 #define ELASUGGESTBOXPRIVATE_H
 
 #include <QAction>
+#include <QCache>
 #include <QObject>
 #include <QSize>
 #include <QVariantMap>
 #include <QVector>
 
 #include "Def.h"
+#include "ElaSuggestProvider.h"
+#include "ElaSuggestionStore.h"
 #include "stdafx.h"
-class ElaSuggestion : public QObject
+struct ElaSuggestCacheData
 {
-    Q_OBJECT
-    Q_PROPERTY_CREATE(ElaIconType::IconName, ElaIcon)
-    Q_PROPERTY_CREATE(QString, SuggestText)
-    Q_PROPERTY_CREATE(QVariantMap, SuggestData)
-public:
-    explicit ElaSuggestion(QObject* parent = nullptr);
-    ~ElaSuggestion();
+    QVector<ElaSuggestResult> suggestionVector;
+    bool isTruncated{false};
 };
 
+class QTimer;
+class QThread;
 class QVBoxLayout;
 class ElaLineEdit;
 class ElaNavigationNode;
@@ -28,24 +28,39 @@ class ElaBaseListView;
 class ElaSuggestDelegate;
 class ElaSuggestBox;
 class ElaSuggestBoxSearchViewContainer;
+class ElaSuggestProviderWorker;
 class ElaSuggestBoxPrivate : public QObject
 {
     Q_OBJECT
     Q_D_CREATE(ElaSuggestBox)
     Q_PROPERTY_CREATE_D(int, BorderRadius)
     Q_PROPERTY_CREATE_D(Qt::CaseSensitivity, CaseSensitivity)
+    Q_PROPERTY_CREATE_D(int, DebounceMsec)
+    Q_PROPERTY_CREATE_D(int, MaxSuggestCount)
 public:
     explicit ElaSuggestBoxPrivate(QObject* parent = nullptr);
     ~ElaSuggestBoxPrivate();
     Q_SLOT void onThemeModeChanged(ElaThemeType::ThemeMode themeMode);
     Q_SLOT void onSearchEditTextEdit(const QString& searchText);
     Q_SLOT void onSearchViewClicked(const QModelIndex& index);
+    Q_SLOT void onDebounceTimeout();
+    Q_SLOT void onQuerySuggestionFinished(quint64 requestID, QString queryText, QVector<ElaSuggestResult> suggestionVector);
+Q_SIGNALS:
+    Q_SIGNAL void querySuggestion(quint64 requestID, QString queryText, Qt::CaseSensitivity caseSensitivity, int maxCount);
 
 private:
     ElaThemeType::ThemeMode _themeMode;
     QAction* _lightSearchAction{nullptr};
     QAction* _darkSearchAction{nullptr};
-    QVector<ElaSuggestion*> _suggestionVector;
+    ElaSuggestionStore _suggestionStore;
+    ElaSuggestProvider* _suggestProvider{nullptr};
+    ElaSuggestProviderWorker* _providerWorker{nullptr};
+    QThread* _providerThread{nullptr};
+    QTimer* _debounceTimer{nullptr};
+    QString _pendingQueryText;
+    quint64 _currentRequestID{0};
+    QCache<QString, ElaSuggestCacheData> _suggestCache;
+    ElaSuggestionStore _providerSuggestionStore;
     ElaSuggestBoxSearchViewContainer* _searchViewBaseWidget{nullptr};
     ElaLineEdit* _searchEdit{nullptr};
     ElaSuggestModel* _searchModel{nullptr};
@@ -55,6 +70,13 @@ private:
     QSize _lastSize;
     bool _isExpandAnimationFinished{true};
     bool _isCloseAnimationFinished{true};
+    void _updateSearchView(const ElaSuggestionStore* suggestionStore, const QVector<int>& rowVector);
+    void _updateProviderSuggestion(const QVector<ElaSuggestResult>& suggestionVector);
+    void _releaseProviderSuggestion();
+    void _refreshLocalSuggestion();
+    QString _getCacheKey(const QString& queryText) const;
+    bool _findCachedSuggestion(const QString& queryText, QVector<ElaSuggestResult>& suggestionVector);
+    void _cancelProviderQuery();
     void _startSizeAnimation(QSize oldSize, QSize newSize);
     void _startExpandAnimation();
     void _startCloseAnimation();
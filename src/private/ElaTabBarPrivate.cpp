@@ -1,5 +1,7 @@
 #include "ElaTabBarPrivate.h"
 
+#include "ElaSnapshotCache.h"
+#include "ElaTabBar.h"
 ElaTabBarPrivate::ElaTabBarPrivate(QObject* parent)
     : QObject{parent}
 {
@@ -8,3 +10,10 @@ ElaTabBarPrivate::ElaTabBarPrivate(QObject* parent)
 ElaTabBarPrivate::~ElaTabBarPrivate()
 {
 }
+
+void ElaTabBarPrivate::_releaseDragPix()
+{
+    Q_Q(ElaTabBar);
+    _lastDragPix = QPixmap();
+    eSnapshotCache->releaseSnapshot(q);
+}
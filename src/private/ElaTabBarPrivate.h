@@ -16,6 +16,8 @@ public:
 
 private:
     QPixmap _lastDragPix;
+    bool _isTabDragging{false};
+    void _releaseDragPix();
 };
 
 #endif // ELATABBARPRIVATE_H
@@ -108,3 +108,29 @@ void ElaThemePrivate::_initThemeColor()
     _lightThemeColorList[ElaThemeType::StatusDanger] = QColor(0xE8, 0x11, 0x23);
     _darkThemeColorList[ElaThemeType::StatusDanger] = QColor(0xE8, 0x11, 0x23);
 }
+
+void ElaThemePrivate::_publishThemePalette(ElaThemeType::ThemeMode themeMode)
+{
+    QSharedPointer<const ElaThemePalette>& palette = themeMode == ElaThemeType::Light ? _lightPalette : _darkPalette;
+    // 更早的快照在此释放 连续修改颜色时内存不再增长
+    (themeMode == ElaThemeType::Light ? _retiredLightPalette : _retiredDarkPalette) = palette;
+    palette.reset(new ElaThemePalette(themeMode, themeMode == ElaThemeType::Light ? _lightThemeColorList : _darkThemeColorList));
+    if (themeMode == ElaThemeType::Light)
+    {
+        ElaThemePalette::_lightPalette.storeRelease(palette.data());
+    }
+    else
+    {
+        ElaThemePalette::_darkPalette.storeRelease(palette.data());
+    }
+    if (themeMode == _themeMode)
+    {
+        _updateCurrentPalette();
+    }
+}
+
+void ElaThemePrivate::_updateCurrentPalette()
+{
+    // 切换主题只替换一个指针
+    ElaThemePalette::_currentPalette.storeRelease(_themeMode == ElaThemeType::Light ? _lightPalette.data() : _darkPalette.data());
+}
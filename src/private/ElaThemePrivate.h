@@ -3,9 +3,11 @@
 
 #include <QColor>
 #include <QMap>
+#include <QSharedPointer>
 #include <QObject>
 
 #include "Def.h"
+#include "ElaThemePalette.h"
 #include "stdafx.h"
 class ElaTheme;
 class ElaThemePrivate : public QObject
@@ -18,9 +20,16 @@ public:
 
 private:
     ElaThemeType::ThemeMode _themeMode{ElaThemeType::Light};
-    QColor _lightThemeColorList[40];
-    QColor _darkThemeColorList[40];
+    QColor _lightThemeColorList[ElaThemePalette::ThemeColorCount];
+    QColor _darkThemeColorList[ElaThemePalette::ThemeColorCount];
+    QSharedPointer<const ElaThemePalette> _lightPalette;
+    QSharedPointer<const ElaThemePalette> _darkPalette;
+    // 每种主题保留上一代快照 替换前读取的指针在下一次替换前仍然有效
+    QSharedPointer<const ElaThemePalette> _retiredLightPalette;
+    QSharedPointer<const ElaThemePalette> _retiredDarkPalette;
     void _initThemeColor();
+    void _publishThemePalette(ElaThemeType::ThemeMode themeMode);
+    void _updateCurrentPalette();
 };
 
 #endif // ELATHEMEPRIVATE_H
@@ -1,7 +1,6 @@
 #include "ElaToggleSwitchPrivate.h"
 
-#include <QPropertyAnimation>
-
+#include "ElaAnimationScheduler.h"
 #include "ElaToggleSwitch.h"
 ElaToggleSwitchPrivate::ElaToggleSwitchPrivate(QObject* parent)
     : QObject{parent}
@@ -15,14 +14,7 @@ ElaToggleSwitchPrivate::~ElaToggleSwitchPrivate()
 void ElaToggleSwitchPrivate::_startPosAnimation(qreal startX, qreal endX, bool isToggle)
 {
     Q_Q(ElaToggleSwitch);
-    QPropertyAnimation* circleAnimation = new QPropertyAnimation(q, "circleCenterX");
-    connect(circleAnimation, &QPropertyAnimation::valueChanged, q, [=](const QVariant& value) {
-                this->_circleCenterX = value.toReal();
-                q->update(); });
-    circleAnimation->setStartValue(startX);
-    circleAnimation->setEndValue(endX);
-    circleAnimation->setEasingCurve(QEasingCurve::InOutSine);
-    circleAnimation->start(QAbstractAnimation::DeleteWhenStopped);
+    eAnimationScheduler->startAnimation(q, "circleCenterX", startX, endX, 250, QEasingCurve::InOutSine, [=](qreal value) { this->_circleCenterX = value; }, q);
     _isToggled = isToggle;
     Q_EMIT q->toggled(isToggle);
 }
@@ -30,14 +22,7 @@ void ElaToggleSwitchPrivate::_startPosAnimation(qreal startX, qreal endX, bool i
 void ElaToggleSwitchPrivate::_startRadiusAnimation(qreal startRadius, qreal endRadius)
 {
     Q_Q(ElaToggleSwitch);
-    QPropertyAnimation* circleRadiusAnimation = new QPropertyAnimation(q, "circleRadius");
-    connect(circleRadiusAnimation, &QPropertyAnimation::valueChanged, q, [=](const QVariant& value) {
-        this->_circleRadius = value.toReal();
-        q->update(); });
-    circleRadiusAnimation->setEasingCurve(QEasingCurve::InOutSine);
-    circleRadiusAnimation->setStartValue(startRadius);
-    circleRadiusAnimation->setEndValue(endRadius);
-    circleRadiusAnimation->start(QAbstractAnimation::DeleteWhenStopped);
+    eAnimationScheduler->startAnimation(q, "circleRadius", startRadius, endRadius, 250, QEasingCurve::InOutSine, [=](qreal value) { this->_circleRadius = value; }, q);
 }
 
 void ElaToggleSwitchPrivate::_adjustCircleCenterX()
@@ -4,6 +4,7 @@
 #include <QPropertyAnimation>
 #include <QTimer>
 
+#include "ElaApplication.h"
 #include "ElaToolTip.h"
 ElaToolTipPrivate::ElaToolTipPrivate(QObject* parent)
     : QObject{parent}
@@ -66,7 +67,7 @@ void ElaToolTipPrivate::_doShowAnimation()
     q->show();
     QPropertyAnimation* showAnimation = new QPropertyAnimation(q, "windowOpacity");
     showAnimation->setEasingCurve(QEasingCurve::InOutSine);
-    showAnimation->setDuration(250);
+    showAnimation->setDuration(eApp->getAnimationDuration(250, true));
     showAnimation->setStartValue(0);
     showAnimation->setEndValue(1);
     showAnimation->start(QAbstractAnimation::DeleteWhenStopped);
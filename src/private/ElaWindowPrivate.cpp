@@ -11,6 +11,7 @@
 #include "ElaApplication.h"
 #include "ElaCentralStackedWidget.h"
 #include "ElaNavigationBar.h"
+#include "ElaSnapshotCache.h"
 #include "ElaTheme.h"
 #include "ElaThemeAnimationWidget.h"
 #include "ElaWindow.h"
@@ -38,7 +39,7 @@ void ElaWindowPrivate::onNavigationButtonClicked()
             _isNavigationBarExpanded = true;
         });
         navigationMoveAnimation->setEasingCurve(QEasingCurve::InOutSine);
-        navigationMoveAnimation->setDuration(300);
+        navigationMoveAnimation->setDuration(eApp->getAnimationDuration(300));
         navigationMoveAnimation->setStartValue(_navigationBar->pos());
         navigationMoveAnimation->setEndValue(QPoint(0, 0));
         navigationMoveAnimation->start(QAbstractAnimation::DeleteWhenStopped);
@@ -77,7 +78,7 @@ void ElaWindowPrivate::onWMWindowClickedEvent(QVariantMap data)
                 _isWMClickedAnimationFinished = true;
             });
             navigationMoveAnimation->setEasingCurve(QEasingCurve::InOutSine);
-            navigationMoveAnimation->setDuration(300);
+            navigationMoveAnimation->setDuration(eApp->getAnimationDuration(300));
             navigationMoveAnimation->setStartValue(_navigationBar->pos());
             navigationMoveAnimation->setEndValue(QPoint(-_navigationBar->width(), 0));
             navigationMoveAnimation->start(QAbstractAnimation::DeleteWhenStopped);
@@ -90,6 +91,15 @@ void ElaWindowPrivate::onThemeReadyChange()
 {
     Q_Q(ElaWindow);
     // 主题变更绘制窗口
+    if (eApp->getAnimationDuration(_pThemeChangeTime) == 0)
+    {
+        // 低动画模式下直接切换 不截取窗口
+        if (!_animationWidget)
+        {
+            eTheme->setThemeMode(eTheme->getThemeMode() == ElaThemeType::Light ? ElaThemeType::Dark : ElaThemeType::Light);
+        }
+        return;
+    }
     _appBar->setIsOnlyAllowMinAndClose(true);
     if (!_animationWidget)
     {
@@ -99,8 +109,12 @@ void ElaWindowPrivate::onThemeReadyChange()
             _appBar->setIsOnlyAllowMinAndClose(false);
             _animationWidget = nullptr;
         });
+        // 动画控件析构后快照不再被持有 归还缓冲池 由池容量上限约束
+        connect(_animationWidget, &QObject::destroyed, this, [=]() {
+            eSnapshotCache->releaseSnapshot(q);
+        });
         _animationWidget->move(0, 0);
-        _animationWidget->setOldWindowBackground(q->grab(q->rect()).toImage());
+        _animationWidget->setOldWindowBackground(eSnapshotCache->renderSnapshot(q, q->rect(), "OldThemeBackground"));
         if (eTheme->getThemeMode() == ElaThemeType::Light)
         {
             eTheme->setThemeMode(ElaThemeType::Dark);
@@ -109,7 +123,7 @@ void ElaWindowPrivate::onThemeReadyChange()
         {
             eTheme->setThemeMode(ElaThemeType::Light);
         }
-        _animationWidget->setNewWindowBackground(q->grab(q->rect()).toImage());
+        _animationWidget->setNewWindowBackground(eSnapshotCache->renderSnapshot(q, q->rect(), "NewThemeBackground"));
         _animationWidget->setCenter(centerPos);
         qreal topLeftDis = _distance(centerPos, QPoint(0, 0));
         qreal topRightDis = _distance(centerPos, QPoint(q->width(), 0));
@@ -181,12 +195,17 @@ void ElaWindowPrivate::onNavigationNodeClicked(ElaNavigationType::NavigationNode
         return;
     }
     _navigationTargetIndex = nodeIndex;
+    if (eApp->getAnimationDuration(300) == 0)
+    {
+        _centerStackedWidget->setCurrentIndex(nodeIndex);
+        return;
+    }
     QTimer::singleShot(180, this, [=]() {
         QWidget* currentWidget = _centerStackedWidget->widget(nodeIndex);
         _centerStackedWidget->setCurrentIndex(nodeIndex);
         QPropertyAnimation* currentWidgetAnimation = new QPropertyAnimation(currentWidget, "pos");
         currentWidgetAnimation->setEasingCurve(QEasingCurve::OutCubic);
-        currentWidgetAnimation->setDuration(300);
+        currentWidgetAnimation->setDuration(eApp->getAnimationDuration(300));
         QPoint currentWidgetPos = currentWidget->pos();
         currentWidgetAnimation->setEndValue(currentWidgetPos);
         currentWidgetPos.setY(currentWidgetPos.y() + 80);